@@ -8,7 +8,7 @@ cd /d "%~dp0\src\C"
 
 echo.
 echo Compiling hamming_dl.c...
-cl /W4 /O2 /nologo hamming_dl.c /Fe"hamming_dl.exe"
+cl /W4 /O2 /openmp /nologo hamming_dl.c /Fe"hamming_dl.exe"
 if %ERRORLEVEL% EQU 0 (
     echo - Success: hamming_dl.exe created
 ) else (
@@ -33,6 +33,42 @@ if %ERRORLEVEL% EQU 0 (
     echo - Error compiling ksubset_dl.c
 )
 
+echo.
+echo Compiling benchmark.c...
+cl /W4 /O2 /nologo /DKNUTH_LIB /DHAMMING_LIB /DKSUBSET_LIB benchmark.c knuth.c hamming_dl.c ksubset_dl.c /Fe"benchmark.exe"
+if %ERRORLEVEL% EQU 0 (
+    echo - Success: benchmark.exe created
+) else (
+    echo - Error compiling benchmark.c
+)
+
+echo.
+echo Compiling nnindex.c...
+cl /W4 /O2 /nologo nnindex.c /Fe"nnindex.exe"
+if %ERRORLEVEL% EQU 0 (
+    echo - Success: nnindex.exe created
+) else (
+    echo - Error compiling nnindex.c
+)
+
+echo.
+echo Compiling hammingdb.c...
+cl /W4 /O2 /nologo hammingdb.c /Fe"hammingdb.exe"
+if %ERRORLEVEL% EQU 0 (
+    echo - Success: hammingdb.exe created
+) else (
+    echo - Error compiling hammingdb.c
+)
+
+echo.
+echo Compiling hammingsimd.c...
+cl /W4 /O2 /nologo /DHAMMINGDB_LIB hammingsimd.c hammingdb.c /Fe"hammingsimd.exe"
+if %ERRORLEVEL% EQU 0 (
+    echo - Success: hammingsimd.exe created
+) else (
+    echo - Error compiling hammingsimd.c
+)
+
 echo.
 echo Compilation complete.
 cd ..\..
@@ -0,0 +1,60 @@
+/**********************************************************************/
+/**********************************************************************/
+/*                                                                    */
+/* Generators.h - Visitor API of the k-subset generators              */
+/*                                                                    */
+/**********************************************************************/
+/* TECHGLISH: Visitor types and prototypes exported by Knuth.c,       */
+/* Hamming_DL.c and ksubset_DL.c. Every generator includes this       */
+/* header, so the compiler checks the definitions against the         */
+/* declarations used by Benchmark.c and by any other caller. A        */
+/* visitor returns false to stop the generation, and the generator    */
+/* then returns false as well.                                        */
+/**********************************************************************/
+/* NERDYTALIAN: Tipi dei visitatori e prototipi esportati da          */
+/* Knuth.c, Hamming_DL.c e ksubset_DL.c. Ogni generatore include      */
+/* questo header, cosi' il compilatore confronta le definizioni con   */
+/* le dichiarazioni usate da Benchmark.c e da ogni altro chiamante.   */
+/* Un visitatore restituisce false per interrompere la generazione,   */
+/* e il generatore a sua volta restituisce false.                     */
+/**********************************************************************/
+/**********************************************************************/
+
+#ifndef _GENERATORS_H_
+ #define _GENERATORS_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Visitatore: riceve S[0..k-1], ordinato, e un contesto opaco */
+typedef bool (*Visitor_t)(const int* S, size_t k, void* ctx);
+
+/* Visitatore per maschere: riceve il sottoinsieme come bit vector */
+typedef bool (*MaskVisitor_t)(uint64_t B, void* ctx);
+
+/* Visitatore per variazioni: riceve l'elemento uscito e quello entrato */
+typedef bool (*DeltaVisitor_t)(int uscito, int entrato, void* ctx);
+
+/*
+** Visitatore di Hamming_DL.c: riceve ogni sottoinsieme come nw parole
+** da 64 bit (la prima e' la meno significativa) con la sua distanza d.
+*/
+typedef bool (*Visitatore_t)(const uint64_t* w, size_t nw, size_t d, void* ctx);
+
+// Knuth.c
+bool T_ksubsetLex(const size_t k, const size_t n, Visitor_t f, void* ctx);
+bool R_ksubsetRD(const size_t k, const size_t n, Visitor_t f, void* ctx);
+bool R_ksubsetRDDelta(const size_t k, const size_t n, DeltaVisitor_t f, void* ctx);
+bool G_ksubsetGosper(const size_t k, const size_t n, Visitor_t f, void* ctx);
+bool G_ksubsetGosperMask(const size_t k, const size_t n, MaskVisitor_t f, void* ctx);
+
+// Hamming_DL.c
+bool visit_k_subset_range(size_t n, size_t k, size_t d, uint64_t first,
+                          uint64_t count, Visitatore_t visita, void* ctx);
+bool hamming_ball_visit(size_t n, size_t k, size_t r, Visitatore_t visita, void* ctx);
+
+// ksubset_DL.c
+bool visitHammingDistance1(size_t k, size_t n, MaskVisitor_t f, void* ctx);
+
+#endif
+/** EOF: Generators.h **/
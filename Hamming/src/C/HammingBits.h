@@ -0,0 +1,61 @@
+/**********************************************************************/
+/**********************************************************************/
+/*                                                                    */
+/* HammingBits.h - Portable bit scan and population count             */
+/*                                                                    */
+/**********************************************************************/
+/* TECHGLISH: CTZ64 (count of trailing zeros, x != 0) and POPCNT64    */
+/* (count of set bits) on 64-bit words, shared by the generators and  */
+/* by the dataset tools of this directory. GCC and Clang use their    */
+/* builtins, MSVC on x64 its intrinsics, any other compiler a plain   */
+/* C fallback.                                                        */
+/**********************************************************************/
+/* NERDYTALIAN: CTZ64 (zeri meno significativi, x != 0) e POPCNT64    */
+/* (bit a 1) su parole da 64 bit, comuni ai generatori e agli         */
+/* strumenti sui dataset di questa directory. GCC e Clang usano le    */
+/* proprie builtin, MSVC su x64 le intrinseche, ogni altro            */
+/* compilatore un ripiego in C standard.                              */
+/**********************************************************************/
+/**********************************************************************/
+
+#ifndef _HAMMING_BITS_H_
+ #define _HAMMING_BITS_H_
+#include <stdint.h>
+
+// Conteggio degli zeri meno significativi, x != 0
+#if defined(__GNUC__) || defined(__clang__)
+ #define CTZ64(x) ((unsigned)__builtin_ctzll(x))
+#elif defined(_MSC_VER) && defined(_M_X64)
+ #include <intrin.h>
+static __inline unsigned CTZ64(uint64_t x) {
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (unsigned)i;
+}
+#else
+static unsigned CTZ64(uint64_t x) {
+    unsigned i = 0;
+    while (0 == (x & 1)) {
+        x >>= 1;
+        ++i;
+    }
+    return i;
+}
+#endif
+
+// Conteggio dei bit a 1
+#if defined(__GNUC__) || defined(__clang__)
+ #define POPCNT64(x) ((unsigned)__builtin_popcountll(x))
+#elif defined(_MSC_VER) && defined(_M_X64)
+ #define POPCNT64(x) ((unsigned)__popcnt64(x))
+#else
+static unsigned POPCNT64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (unsigned)((x * 0x0101010101010101ULL) >> 56);
+}
+#endif
+
+#endif
+/** EOF: HammingBits.h **/
@@ -0,0 +1,145 @@
+/**********************************************************************/
+/**********************************************************************/
+/*                                                                    */
+/* HammingDB.h - Binary dataset format for Hamming classes            */
+/*                                                                    */
+/**********************************************************************/
+/* TECHGLISH: A .hdb file holds the complete classification of the    */
+/* k-subsets of an n-set (n <= 64) by Hamming distance from a         */
+/* reference subset, as raw masks ready to be mapped in memory. All   */
+/* the fields are little-endian:                                      */
+/*                                                                    */
+/*   0  char[4]   magic "HMDB"                                        */
+/*   4  uint32    version (1)                                         */
+/*   8  uint32    n                                                   */
+/*  12  uint32    k                                                   */
+/*  16  uint32    bytes per mask: 4 if n <= 32, otherwise 8           */
+/*  20  uint32    reserved (0)                                        */
+/*  24  uint64    reference mask                                      */
+/*  32  uint64    byte offset of the masks, a multiple of 64          */
+/*  40  uint64[k+2] first record of each class d = 0..k, then the     */
+/*                total; class d is records offset[d]..offset[d+1]-1  */
+/*                                                                    */
+/* The masks follow the padded header, class by class, in the order   */
+/* of the generator. Hamming_DL.c writes this format directly with    */
+/* -f, HammingDB.c converts the text .dat files and reads .hdb files. */
+/**********************************************************************/
+/* NERDYTALIAN: Un file .hdb contiene la classificazione completa dei */
+/* k-sottoinsiemi di un n-insieme (n <= 64) per distanza di Hamming   */
+/* da un sottoinsieme di riferimento, come maschere pronte per essere */
+/* mappate in memoria. Tutti i campi sono little-endian, con il       */
+/* tracciato descritto sopra. Le maschere seguono l'intestazione,     */
+/* allineata a 64 byte, classe per classe nell'ordine del generatore. */
+/* Hamming_DL.c scrive direttamente questo formato con -f,            */
+/* HammingDB.c converte i file di testo .dat e legge i file .hdb.     */
+/**********************************************************************/
+/**********************************************************************/
+
+#ifndef _HAMMING_DB_H_
+ #define _HAMMING_DB_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HDB_MAGIC      "HMDB"
+#define HDB_VERSIONE   1
+#define HDB_MAX_N      64
+#define HDB_MAX_K      (HDB_MAX_N / 2)
+#define HDB_ALLINEA    64
+#define HDB_POS_OFFSET 40
+// Intestazione piu' lunga possibile, gia' allineata
+#define HDB_MAX_HEADER (((HDB_POS_OFFSET + 8 * (HDB_MAX_K + 2)) + HDB_ALLINEA - 1) \
+                        / HDB_ALLINEA * HDB_ALLINEA)
+
+/*
+** Dataset aperto in lettura: l'intestazione decodificata e il puntatore
+** alle maschere all'interno della mappatura del file.
+*/
+typedef struct {
+    uint32_t       n;
+    uint32_t       k;
+    uint32_t       larghezza;               // Byte per maschera
+    uint64_t       riferimento;
+    uint64_t       offset[HDB_MAX_K + 2];
+    const uint8_t* dati;
+    void*          base;                    // Mappatura dell'intero file
+    size_t         dim;
+    void*          file;                    // Handle Windows, altrove NULL
+    void*          mappa;
+} HammingDB_t;
+
+static inline void hdb_put_le(uint8_t* p, uint64_t x, size_t len) {
+    for (size_t b = 0; b < len; ++b) {
+        p[b] = (uint8_t)(x >> (8 * b));
+    }
+}
+
+static inline uint64_t hdb_get_le(const uint8_t* p, size_t len) {
+    uint64_t x = 0;
+    for (size_t b = len; b-- > 0; ) {
+        x = (x << 8) | p[b];
+    }
+    return x;
+}
+
+/*
+** Scrive in buf (almeno HDB_MAX_HEADER byte) l'intestazione, gia'
+** completata dal riempimento, e ne restituisce la lunghezza. offset[]
+** ha k+2 elementi: l'inizio di ogni classe e il totale.
+*/
+static inline size_t hdb_header(uint8_t* buf, size_t n, size_t k,
+                                uint64_t riferimento, const uint64_t* offset) {
+    const size_t dati = (HDB_POS_OFFSET + 8 * (k + 2) + HDB_ALLINEA - 1)
+                        / HDB_ALLINEA * HDB_ALLINEA;
+    for (size_t b = 0; b < dati; ++b) {
+        buf[b] = 0;
+    }
+    for (size_t b = 0; b < 4; ++b) {
+        buf[b] = (uint8_t)HDB_MAGIC[b];
+    }
+    hdb_put_le(buf + 4, HDB_VERSIONE, 4);
+    hdb_put_le(buf + 8, n, 4);
+    hdb_put_le(buf + 12, k, 4);
+    hdb_put_le(buf + 16, (n <= 32) ? 4 : 8, 4);
+    hdb_put_le(buf + 24, riferimento, 8);
+    hdb_put_le(buf + 32, dati, 8);
+    for (size_t d = 0; d < k + 2; ++d) {
+        hdb_put_le(buf + HDB_POS_OFFSET + 8 * d, offset[d], 8);
+    }
+    return dati;
+}
+
+// Numero di maschere della classe d
+static inline uint64_t hdb_classe_num(const HammingDB_t* db, size_t d) {
+    return (d <= db->k) ? db->offset[d + 1] - db->offset[d] : 0;
+}
+
+/*
+** Maschera i-esima della classe d, in tempo costante. Restituisce 0, che
+** non e' un k-sottoinsieme con k > 0, se d > k o i e' oltre la classe.
+*/
+static inline uint64_t hdb_maschera(const HammingDB_t* db, size_t d, uint64_t i) {
+    if (i >= hdb_classe_num(db, d)) {
+        return 0;
+    }
+    return hdb_get_le(db->dati + (db->offset[d] + i) * db->larghezza, db->larghezza);
+}
+
+/*
+** Apre e mappa in sola lettura un file .hdb, verificandone
+** l'intestazione (riferimento di k bit entro n compreso) e la
+** lunghezza. Restituisce false in caso d'errore.
+*/
+bool hdb_apri(HammingDB_t* db, const char* nome);
+
+// Rilascia la mappatura
+void hdb_chiudi(HammingDB_t* db);
+
+/*
+** Puntatore alle maschere impacchettate della classe d: uint32_t se
+** larghezza vale 4, altrimenti uint64_t, little-endian. NULL se d > k.
+*/
+const void* hdb_classe(const HammingDB_t* db, size_t d);
+
+#endif
+/** EOF: HammingDB.h **/
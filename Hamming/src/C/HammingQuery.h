@@ -0,0 +1,83 @@
+/**********************************************************************/
+/**********************************************************************/
+/*                                                                    */
+/* HammingQuery.h - Command line parsing of queries and radii         */
+/*                                                                    */
+/**********************************************************************/
+/* TECHGLISH: Validated parsing of the command line arguments shared  */
+/* by the dataset tools of this directory: a decimal number within a  */
+/* bound, and a query subset given as comma separated indices below   */
+/* n. Every malformed argument is reported on stderr and rejected,    */
+/* so that no caller loops on a character strtoul does not consume.   */
+/**********************************************************************/
+/* NERDYTALIAN: Lettura convalidata degli argomenti comuni agli       */
+/* strumenti sui dataset di questa directory: un numero decimale      */
+/* entro un limite, e un sottoinsieme di query dato come indici       */
+/* minori di n separati da virgole. Ogni argomento malformato e'      */
+/* segnalato su stderr e rifiutato, cosi' che nessun chiamante cicli  */
+/* su un carattere che strtoul non consuma.                           */
+/**********************************************************************/
+/**********************************************************************/
+
+#ifndef _HAMMING_QUERY_H_
+ #define _HAMMING_QUERY_H_
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Numero decimale in 0..max, senza segno ne' caratteri in coda
+static inline bool leggi_numero(const char* s, unsigned long max, unsigned long* x) {
+    char* fine;
+
+    if ((s[0] < '0') || (s[0] > '9')) {
+        fprintf(stderr, "\"%s\" non e' un numero.\n", s);
+        return false;
+    }
+    *x = strtoul(s, &fine, 10);
+    if ('\0' != *fine) {
+        fprintf(stderr, "\"%s\" non e' un numero.\n", s);
+        return false;
+    }
+    if (*x > max) {
+        fprintf(stderr, "%s fuori da 0..%lu.\n", s, max);
+        return false;
+    }
+    return true;
+}
+
+// Sottoinsieme "i,j,..." con indici in 0..n-1, come maschera in *q
+static inline bool leggi_query(const char* s, size_t n, uint64_t* q) {
+    const char* p = s;
+
+    *q = 0;
+    for (;;) {
+        char* fine;
+        unsigned long i;
+
+        if ((*p < '0') || (*p > '9')) {
+            fprintf(stderr, "Query \"%s\" malformata: atteso un indice in posizione %u.\n",
+                    s, (unsigned)(p - s));
+            return false;
+        }
+        i = strtoul(p, &fine, 10);
+        if (i >= n) {
+            fprintf(stderr, "Indice %lu fuori da 0..%zu.\n", i, n - 1);
+            return false;
+        }
+        *q |= 1ULL << i;
+        p = fine;
+        if ('\0' == *p) {
+            return true;
+        }
+        if (',' != *p) {
+            fprintf(stderr, "Query \"%s\" malformata: separatore '%c' in posizione %u.\n",
+                    s, *p, (unsigned)(p - s));
+            return false;
+        }
+        ++p;
+    }
+}
+
+#endif
+/** EOF: HammingQuery.h **/
@@ -0,0 +1,576 @@
+/**********************************************************************/
+/**********************************************************************/
+/*                                                                    */
+/* HammingSIMD.c - Bulk query-vs-dataset Hamming distance kernels     */
+/*                                                                    */
+/**********************************************************************/
+/* CODE METRICS:                                                      */
+/* Size metrics:                                                      */
+/*   - Lines of Code (LOC): 576                                       */
+/*   - Logical Lines of Code (LLOC): 237                              */
+/*   - Comment Lines: 132                                             */
+/*   - Comment-to-Code Ratio: 0.33                                    */
+/* Complexity metrics:                                                */
+/*   - Cyclomatic Complexity: 89                                      */
+/*   - Maximum Nesting Level: 2                                       */
+/*   - Maintainability Index: 80 (Good)                               */
+/**********************************************************************/
+/* TECHGLISH: Computes popcount(q XOR m) for every mask m of a .hdb   */
+/* dataset (HammingDB.h), straight on the memory mapping: either all  */
+/* the distances, one byte each, or a histogram of the distances, or  */
+/* the indices of the masks within a distance threshold. There are    */
+/* three kernels, chosen at runtime from CPUID: AVX-512 with          */
+/* VPOPCNTDQ, AVX2 with the nibble-LUT popcount (VPSHUFB on the two   */
+/* halves of every byte, then horizontal sums), and a portable scalar */
+/* one. The SIMD kernels are compiled with function-level target      */
+/* attributes, so the program needs no special compiler flags and     */
+/* still runs on any x86-64 or on other architectures.                */
+/**********************************************************************/
+/* NERDYTALIAN: Calcola popcount(q XOR m) per ogni maschera m di un   */
+/* dataset .hdb (HammingDB.h), direttamente sulla mappatura in        */
+/* memoria: tutte le distanze, un byte ciascuna, oppure l'istogramma  */
+/* delle distanze, oppure gli indici delle maschere entro una soglia  */
+/* di distanza. I kernel sono tre, scelti a runtime tramite CPUID:    */
+/* AVX-512 con VPOPCNTDQ, AVX2 con il popcount a tabella sui nibble   */
+/* (VPSHUFB sulle due meta' di ogni byte, poi somme orizzontali) e    */
+/* uno scalare portabile. I kernel SIMD sono compilati con attributi  */
+/* target a livello di funzione, quindi il programma non richiede     */
+/* opzioni particolari del compilatore e funziona comunque su ogni    */
+/* x86-64 o su altre architetture.                                    */
+/**********************************************************************/
+/**********************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+ #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#if defined(_WIN32)
+ #include <windows.h>
+#endif
+#include "HammingDB.h"
+#include "HammingBits.h"
+#include "HammingSIMD.h"
+#if !defined(HAMMINGSIMD_LIB)
+ #include "HammingQuery.h"
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+ #define HD_X86
+ #include <immintrin.h>
+ #if defined(_MSC_VER)
+  #include <intrin.h>
+ #endif
+#endif
+
+// Attributi target: i kernel SIMD si compilano senza -mavx2/-mavx512f
+#if defined(HD_X86) && (defined(__GNUC__) || defined(__clang__))
+ #define TARGET_AVX2   __attribute__((target("avx2")))
+ #define TARGET_AVX512 __attribute__((target("avx512f,avx512vpopcntdq")))
+#else
+ #define TARGET_AVX2
+ #define TARGET_AVX512
+#endif
+
+// Maschere elaborate per blocco dall'istogramma
+#define BLOCCO_ISTO 4096
+
+/******************* KERNEL INTERFACE ***************************/
+/* TECHGLISH: Every kernel has a distance and a threshold entry */
+/* point for each mask width, 4 bytes (n <= 32) and 8 bytes.    */
+/* The masks are little-endian, as stored in a .hdb file; the   */
+/* scalar kernel reads them with memcpy(), hence it assumes a   */
+/* little-endian host, like every target of this directory.     */
+/*                                                              */
+/* NERDYTALIAN: Ogni kernel ha un punto d'ingresso per le       */
+/* distanze e uno per la soglia per ciascuna larghezza delle    */
+/* maschere, 4 byte (n <= 32) e 8 byte. Le maschere sono        */
+/* little-endian, come nel file .hdb; il kernel scalare le legge */
+/* con memcpy(), supponendo quindi un host little-endian, come  */
+/* ogni piattaforma di questa directory.                        */
+/****************************************************************/
+
+// Distanza di ogni maschera da q, un byte ciascuna
+typedef void (*Distanze_t)(const uint8_t* dati, size_t num, uint64_t q, uint8_t* out);
+// Indici delle maschere a distanza <= R, restituisce quante sono
+typedef size_t (*Soglia_t)(const uint8_t* dati, size_t num, uint64_t q, unsigned R, uint32_t* out);
+
+typedef struct {
+    const char* nome;
+    Distanze_t  distanze[2];            // [0]: 4 byte, [1]: 8 byte
+    Soglia_t    soglia[2];
+} Kernel_t;
+
+/******************* SCALAR KERNEL ******************************/
+
+static void dist32_scalare(const uint8_t* dati, size_t num, uint64_t q, uint8_t* out) {
+    for (size_t i = 0; i < num; ++i) {
+        uint32_t m;
+        memcpy(&m, dati + 4 * i, 4);
+        out[i] = (uint8_t)POPCNT64((uint64_t)(m ^ (uint32_t)q));
+    }
+}
+
+static void dist64_scalare(const uint8_t* dati, size_t num, uint64_t q, uint8_t* out) {
+    for (size_t i = 0; i < num; ++i) {
+        uint64_t m;
+        memcpy(&m, dati + 8 * i, 8);
+        out[i] = (uint8_t)POPCNT64(m ^ q);
+    }
+}
+
+// Soglia sulle maschere inizio..num-1; serve anche per le code SIMD
+static size_t soglia32_da(const uint8_t* dati, size_t inizio, size_t num, uint64_t q,
+                          unsigned R, uint32_t* out) {
+    size_t c = 0;
+    for (size_t i = inizio; i < num; ++i) {
+        uint32_t m;
+        memcpy(&m, dati + 4 * i, 4);
+        if (POPCNT64((uint64_t)(m ^ (uint32_t)q)) <= R) {
+            out[c++] = (uint32_t)i;
+        }
+    }
+    return c;
+}
+
+static size_t soglia64_da(const uint8_t* dati, size_t inizio, size_t num, uint64_t q,
+                          unsigned R, uint32_t* out) {
+    size_t c = 0;
+    for (size_t i = inizio; i < num; ++i) {
+        uint64_t m;
+        memcpy(&m, dati + 8 * i, 8);
+        if (POPCNT64(m ^ q) <= R) {
+            out[c++] = (uint32_t)i;
+        }
+    }
+    return c;
+}
+
+static size_t soglia32_scalare(const uint8_t* dati, size_t num, uint64_t q, unsigned R, uint32_t* out) {
+    return soglia32_da(dati, 0, num, q, R, out);
+}
+
+static size_t soglia64_scalare(const uint8_t* dati, size_t num, uint64_t q, unsigned R, uint32_t* out) {
+    return soglia64_da(dati, 0, num, q, R, out);
+}
+
+static const Kernel_t kernel_scalare = {
+    "scalare", {dist32_scalare, dist64_scalare}, {soglia32_scalare, soglia64_scalare}
+};
+
+#if defined(HD_X86)
+/******************* AVX2 KERNEL ********************************/
+/* TECHGLISH: VPSHUFB looks up the popcount of the low and the  */
+/* high nibble of all 32 bytes at once; the byte counts are     */
+/* summed per 32-bit lane with two multiply-adds by one, or per */
+/* 64-bit lane with VPSADBW against zero. Eight distances are   */
+/* then packed into 8 bytes, or compared with R into a bitmask  */
+/* whose set bits are the matches.                              */
+/*                                                              */
+/* NERDYTALIAN: VPSHUFB ricava il popcount del nibble basso e   */
+/* di quello alto di tutti i 32 byte in una volta; i conteggi   */
+/* per byte si sommano per corsia a 32 bit con due              */
+/* moltiplicazioni-somma per uno, o per corsia a 64 bit con     */
+/* VPSADBW contro zero. Otto distanze vengono poi impacchettate */
+/* in 8 byte, oppure confrontate con R in una maschera di bit i */
+/* cui bit a 1 sono le corrispondenze.                          */
+/****************************************************************/
+
+TARGET_AVX2 static inline __m256i popcnt8_avx2(__m256i x) {
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i lo = _mm256_and_si256(x, nibble);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+    return _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo), _mm256_shuffle_epi8(lut, hi));
+}
+
+// Otto distanze su 32 bit: da 8 maschere a 4 byte
+TARGET_AVX2 static inline __m256i dist8x32_avx2(const uint8_t* p, __m256i q) {
+    const __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)p), q);
+    const __m256i c = popcnt8_avx2(x);
+    return _mm256_madd_epi16(_mm256_maddubs_epi16(c, _mm256_set1_epi8(1)), _mm256_set1_epi16(1));
+}
+
+// Otto distanze su 32 bit, in ordine: da 8 maschere a 8 byte
+TARGET_AVX2 static inline __m256i dist8x64_avx2(const uint8_t* p, __m256i q) {
+    const __m256i z = _mm256_setzero_si256();
+    const __m256i a = _mm256_sad_epu8(popcnt8_avx2(_mm256_xor_si256(
+                          _mm256_loadu_si256((const __m256i*)p), q)), z);
+    const __m256i b = _mm256_sad_epu8(popcnt8_avx2(_mm256_xor_si256(
+                          _mm256_loadu_si256((const __m256i*)(p + 32)), q)), z);
+    // Corsie a 32 bit d0 d4 d1 d5 d2 d6 d3 d7, riordinate
+    const __m256i ab = _mm256_or_si256(a, _mm256_slli_epi64(b, 32));
+    return _mm256_permutevar8x32_epi32(ab, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+}
+
+// Otto interi a 32 bit minori di 256 in otto byte consecutivi
+TARGET_AVX2 static inline void store8_avx2(uint8_t* out, __m256i d) {
+    __m256i p = _mm256_packus_epi32(d, d);
+    p = _mm256_packus_epi16(p, p);
+    p = _mm256_permutevar8x32_epi32(p, _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+    _mm_storel_epi64((__m128i*)out, _mm256_castsi256_si128(p));
+}
+
+TARGET_AVX2 static void dist32_avx2(const uint8_t* dati, size_t num, uint64_t q, uint8_t* out) {
+    const __m256i qv = _mm256_set1_epi32((int)(uint32_t)q);
+    size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        store8_avx2(out + i, dist8x32_avx2(dati + 4 * i, qv));
+    }
+    dist32_scalare(dati + 4 * i, num - i, q, out + i);
+}
+
+TARGET_AVX2 static void dist64_avx2(const uint8_t* dati, size_t num, uint64_t q, uint8_t* out) {
+    const __m256i qv = _mm256_set1_epi64x((long long)q);
+    size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        store8_avx2(out + i, dist8x64_avx2(dati + 8 * i, qv));
+    }
+    dist64_scalare(dati + 8 * i, num - i, q, out + i);
+}
+
+TARGET_AVX2 static size_t soglia32_avx2(const uint8_t* dati, size_t num, uint64_t q, unsigned R, uint32_t* out) {
+    const __m256i qv = _mm256_set1_epi32((int)(uint32_t)q);
+    const __m256i r1 = _mm256_set1_epi32((int)R + 1);
+    size_t i = 0, c = 0;
+    for (; i + 8 <= num; i += 8) {
+        const __m256i d = dist8x32_avx2(dati + 4 * i, qv);
+        unsigned m = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(r1, d)));
+        for (; 0 != m; m &= m - 1) {
+            out[c++] = (uint32_t)(i + CTZ64(m));
+        }
+    }
+    return c + soglia32_da(dati, i, num, q, R, out + c);
+}
+
+TARGET_AVX2 static size_t soglia64_avx2(const uint8_t* dati, size_t num, uint64_t q, unsigned R, uint32_t* out) {
+    const __m256i qv = _mm256_set1_epi64x((long long)q);
+    const __m256i r1 = _mm256_set1_epi32((int)R + 1);
+    size_t i = 0, c = 0;
+    for (; i + 8 <= num; i += 8) {
+        const __m256i d = dist8x64_avx2(dati + 8 * i, qv);
+        unsigned m = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(r1, d)));
+        for (; 0 != m; m &= m - 1) {
+            out[c++] = (uint32_t)(i + CTZ64(m));
+        }
+    }
+    return c + soglia64_da(dati, i, num, q, R, out + c);
+}
+
+static const Kernel_t kernel_avx2 = {
+    "AVX2", {dist32_avx2, dist64_avx2}, {soglia32_avx2, soglia64_avx2}
+};
+
+/******************* AVX-512 KERNEL *****************************/
+/* TECHGLISH: VPOPCNTD/VPOPCNTQ count 16 or 8 lanes at once;    */
+/* VPMOVDB/VPMOVQB narrow the distances to bytes, and unsigned  */
+/* compares give the match bitmask directly.                    */
+/*                                                              */
+/* NERDYTALIAN: VPOPCNTD/VPOPCNTQ contano 16 o 8 corsie in una  */
+/* volta; VPMOVDB/VPMOVQB riducono le distanze a byte, e i      */
+/* confronti senza segno danno direttamente la maschera delle   */
+/* corrispondenze.                                              */
+/****************************************************************/
+
+TARGET_AVX512 static void dist32_avx512(const uint8_t* dati, size_t num, uint64_t q, uint8_t* out) {
+    const __m512i qv = _mm512_set1_epi32((int)(uint32_t)q);
+    size_t i = 0;
+    for (; i + 16 <= num; i += 16) {
+        const __m512i x = _mm512_xor_si512(_mm512_loadu_si512((const void*)(dati + 4 * i)), qv);
+        _mm_storeu_si128((__m128i*)(out + i), _mm512_cvtepi32_epi8(_mm512_popcnt_epi32(x)));
+    }
+    dist32_scalare(dati + 4 * i, num - i, q, out + i);
+}
+
+TARGET_AVX512 static void dist64_avx512(const uint8_t* dati, size_t num, uint64_t q, uint8_t* out) {
+    const __m512i qv = _mm512_set1_epi64((long long)q);
+    size_t i = 0;
+    for (; i + 8 <= num; i += 8) {
+        const __m512i x = _mm512_xor_si512(_mm512_loadu_si512((const void*)(dati + 8 * i)), qv);
+        _mm_storel_epi64((__m128i*)(out + i), _mm512_cvtepi64_epi8(_mm512_popcnt_epi64(x)));
+    }
+    dist64_scalare(dati + 8 * i, num - i, q, out + i);
+}
+
+TARGET_AVX512 static size_t soglia32_avx512(const uint8_t* dati, size_t num, uint64_t q, unsigned R, uint32_t* out) {
+    const __m512i qv = _mm512_set1_epi32((int)(uint32_t)q);
+    const __m512i rv = _mm512_set1_epi32((int)R);
+    size_t i = 0, c = 0;
+    for (; i + 16 <= num; i += 16) {
+        const __m512i x = _mm512_xor_si512(_mm512_loadu_si512((const void*)(dati + 4 * i)), qv);
+        unsigned m = (unsigned)_mm512_cmple_epu32_mask(_mm512_popcnt_epi32(x), rv);
+        for (; 0 != m; m &= m - 1) {
+            out[c++] = (uint32_t)(i + CTZ64(m));
+        }
+    }
+    return c + soglia32_da(dati, i, num, q, R, out + c);
+}
+
+TARGET_AVX512 static size_t soglia64_avx512(const uint8_t* dati, size_t num, uint64_t q, unsigned R, uint32_t* out) {
+    const __m512i qv = _mm512_set1_epi64((long long)q);
+    const __m512i rv = _mm512_set1_epi64((long long)R);
+    size_t i = 0, c = 0;
+    for (; i + 8 <= num; i += 8) {
+        const __m512i x = _mm512_xor_si512(_mm512_loadu_si512((const void*)(dati + 8 * i)), qv);
+        unsigned m = (unsigned)_mm512_cmple_epu64_mask(_mm512_popcnt_epi64(x), rv);
+        for (; 0 != m; m &= m - 1) {
+            out[c++] = (uint32_t)(i + CTZ64(m));
+        }
+    }
+    return c + soglia64_da(dati, i, num, q, R, out + c);
+}
+
+static const Kernel_t kernel_avx512 = {
+    "AVX-512", {dist32_avx512, dist64_avx512}, {soglia32_avx512, soglia64_avx512}
+};
+
+/******************* CPU DETECTION ******************************/
+/* TECHGLISH: A kernel is usable only if the CPU has the        */
+/* instructions and the OS saves the wider registers (XGETBV).  */
+/*                                                              */
+/* NERDYTALIAN: Un kernel e' utilizzabile solo se la CPU ha le  */
+/* istruzioni e il sistema operativo salva i registri piu'      */
+/* ampi (XGETBV).                                               */
+/****************************************************************/
+
+#if defined(_MSC_VER)
+static bool cpu_supporta(bool avx512) {
+    int r[4];
+    uint64_t xcr0;
+    __cpuid(r, 0);
+    if (r[0] < 7) {
+        return false;
+    }
+    __cpuid(r, 1);
+    if (!((r[2] >> 27) & 1)) {              // OSXSAVE
+        return false;
+    }
+    xcr0 = _xgetbv(0);
+    __cpuidex(r, 7, 0);
+    if (!avx512) {
+        return (6 == (xcr0 & 6)) && ((r[1] >> 5) & 1);
+    }
+    return (0xE6 == (xcr0 & 0xE6)) && ((r[1] >> 16) & 1) && ((r[2] >> 14) & 1);
+}
+#else
+static bool cpu_supporta(bool avx512) {
+    __builtin_cpu_init();
+    return avx512 ? (__builtin_cpu_supports("avx512f") &&
+                     __builtin_cpu_supports("avx512vpopcntdq"))
+                  : __builtin_cpu_supports("avx2");
+}
+#endif
+#endif
+
+/******************* PUBLIC API *********************************/
+/* TECHGLISH: hd_init() picks the best kernel, or the one named */
+/* by the caller; the other functions work on any packed mask   */
+/* array with the .hdb layout, such as hdb_classe(db, d).       */
+/*                                                              */
+/* NERDYTALIAN: hd_init() sceglie il kernel migliore, o quello  */
+/* indicato dal chiamante; le altre funzioni operano su ogni    */
+/* vettore di maschere impacchettate secondo il formato .hdb,   */
+/* come hdb_classe(db, d).                                      */
+/****************************************************************/
+
+static const Kernel_t* kernel = &kernel_scalare;
+
+/*
+** Seleziona il kernel: nome NULL per il migliore disponibile, oppure
+** "scalare", "AVX2", "AVX-512". Restituisce false se non e' supportato.
+*/
+bool hd_init(const char* nome) {
+    const Kernel_t* scelto = &kernel_scalare;
+#if defined(HD_X86)
+    if (cpu_supporta(true) && ((NULL == nome) || (0 == strcmp(nome, kernel_avx512.nome)))) {
+        scelto = &kernel_avx512;
+    } else if (cpu_supporta(false) && ((NULL == nome) || (0 == strcmp(nome, kernel_avx2.nome)))) {
+        scelto = &kernel_avx2;
+    }
+#endif
+    if ((NULL != nome) && (0 != strcmp(nome, scelto->nome))) {
+        return false;
+    }
+    kernel = scelto;
+    return true;
+}
+
+const char* hd_kernel(void) {
+    return kernel->nome;
+}
+
+// Distanze di num maschere da q in out[0..num-1]
+void hd_distanze(const uint8_t* dati, size_t larghezza, size_t num, uint64_t q, uint8_t* out) {
+    kernel->distanze[8 == larghezza](dati, num, q, out);
+}
+
+// Indici delle maschere a distanza <= R in out[], restituisce quante sono
+size_t hd_soglia(const uint8_t* dati, size_t larghezza, size_t num, uint64_t q,
+                 unsigned R, uint32_t* out) {
+    return kernel->soglia[8 == larghezza](dati, num, q, R, out);
+}
+
+// Istogramma delle distanze 0..64; quattro parziali evitano le dipendenze
+void hd_istogramma(const uint8_t* dati, size_t larghezza, size_t num, uint64_t q,
+                   uint64_t isto[65]) {
+    uint8_t d[BLOCCO_ISTO];
+    uint64_t parz[4][65];
+
+    memset(parz, 0, sizeof(parz));
+    for (size_t i = 0; i < num; i += BLOCCO_ISTO) {
+        const size_t quanti = (num - i < BLOCCO_ISTO) ? num - i : BLOCCO_ISTO;
+        size_t j = 0;
+        kernel->distanze[8 == larghezza](dati + i * larghezza, quanti, q, d);
+        for (; j + 4 <= quanti; j += 4) {
+            ++parz[0][d[j]];
+            ++parz[1][d[j + 1]];
+            ++parz[2][d[j + 2]];
+            ++parz[3][d[j + 3]];
+        }
+        for (; j < quanti; ++j) {
+            ++parz[0][d[j]];
+        }
+    }
+    for (size_t v = 0; v <= 64; ++v) {
+        isto[v] = parz[0][v] + parz[1][v] + parz[2][v] + parz[3][v];
+    }
+}
+
+#if !defined(HAMMINGSIMD_LIB)
+/******************* BENCHMARK **********************************/
+/* TECHGLISH: Maps a .hdb file and, for every kernel the CPU    */
+/* supports, times distances, histogram and threshold over the  */
+/* whole dataset (best of 5 runs), checks each result against   */
+/* the scalar kernel and reports the throughput in GB/s of      */
+/* masks read.                                                  */
+/*                                                              */
+/* NERDYTALIAN: Mappa un file .hdb e, per ogni kernel supportato*/
+/* dalla CPU, misura distanze, istogramma e soglia sull'intero  */
+/* dataset (miglior tempo su 5 esecuzioni), verifica ogni       */
+/* risultato con il kernel scalare e riporta il throughput in   */
+/* GB/s di maschere lette.                                      */
+/****************************************************************/
+
+static double orologio(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER f, t;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&t);
+    return (double)t.QuadPart / (double)f.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+int main(int argc, char* argv[]) {
+    static const char* nomi[] = {"scalare", "AVX2", "AVX-512"};
+    HammingDB_t db;
+    const uint8_t* dati;
+    uint8_t *d_rif, *d;
+    uint32_t *s_rif, *s;
+    uint64_t isto_rif[65], isto[65], q = 0;
+    size_t num, bytes, c_rif = 0, errori = 0;
+    unsigned R = 2;
+
+    if ((argc < 3) || (argc > 4)) {
+        fprintf(stderr, "Uso: %s file.hdb i,j,... [R]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!hdb_apri(&db, argv[1])) {
+        fprintf(stderr, "%s non e' un file .hdb valido.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    if (!leggi_query(argv[2], db.n, &q)) {
+        hdb_chiudi(&db);
+        return EXIT_FAILURE;
+    }
+    if (4 == argc) {
+        unsigned long x;
+        if (!leggi_numero(argv[3], 64, &x)) {
+            hdb_chiudi(&db);
+            return EXIT_FAILURE;
+        }
+        R = (unsigned)x;
+    }
+
+    dati = (const uint8_t*)hdb_classe(&db, 0);
+    num = (size_t)db.offset[db.k + 1];
+    bytes = num * db.larghezza;
+    d_rif = (uint8_t*)malloc(num);
+    d = (uint8_t*)malloc(num);
+    s_rif = (uint32_t*)malloc(num * sizeof(uint32_t));
+    s = (uint32_t*)malloc(num * sizeof(uint32_t));
+    if ((NULL == d_rif) || (NULL == d) || (NULL == s_rif) || (NULL == s)) {
+        fprintf(stderr, "Memoria insufficiente.\n");
+        hdb_chiudi(&db);
+        free(d_rif);
+        free(d);
+        free(s_rif);
+        free(s);
+        return EXIT_FAILURE;
+    }
+
+    printf("%s: %zu maschere da %u byte (%.1f MB), query %016llX, soglia R = %u\n",
+           argv[1], num, db.larghezza, bytes / 1048576.0, (unsigned long long)q, R);
+    printf("GB/s di maschere lette, miglior tempo su 5 esecuzioni:\n");
+    printf("%-8s %10s %10s %10s\n", "kernel", "distanze", "isto", "soglia");
+
+    for (size_t kk = 0; kk < sizeof(nomi) / sizeof(nomi[0]); ++kk) {
+        double best[3] = {1e30, 1e30, 1e30};
+        size_t c = 0;
+        if (!hd_init(nomi[kk])) {
+            printf("%-8s non supportato da questa CPU\n", nomi[kk]);
+            continue;
+        }
+        for (int r = 0; r < 5; ++r) {
+            double t0 = orologio(), t1, t2, t3;
+            hd_distanze(dati, db.larghezza, num, q, d);
+            t1 = orologio();
+            hd_istogramma(dati, db.larghezza, num, q, isto);
+            t2 = orologio();
+            c = hd_soglia(dati, db.larghezza, num, q, R, s);
+            t3 = orologio();
+            best[0] = (t1 - t0 < best[0]) ? t1 - t0 : best[0];
+            best[1] = (t2 - t1 < best[1]) ? t2 - t1 : best[1];
+            best[2] = (t3 - t2 < best[2]) ? t3 - t2 : best[2];
+        }
+        if (0 == kk) {
+            memcpy(d_rif, d, num);
+            memcpy(isto_rif, isto, sizeof(isto));
+            memcpy(s_rif, s, c * sizeof(uint32_t));
+            c_rif = c;
+        } else {
+            errori += (0 != memcmp(d_rif, d, num)) ||
+                      (0 != memcmp(isto_rif, isto, sizeof(isto))) ||
+                      (c != c_rif) || (0 != memcmp(s_rif, s, c * sizeof(uint32_t)));
+        }
+        printf("%-8s %10.2f %10.2f %10.2f\n", nomi[kk], (double)bytes / best[0] * 1e-9,
+               (double)bytes / best[1] * 1e-9, (double)bytes / best[2] * 1e-9);
+    }
+
+    printf("\nIstogramma delle distanze di Hamming da q:\n");
+    for (size_t v = 0; v <= 64; ++v) {
+        if (isto_rif[v] > 0) {
+            printf("%4zu: %llu\n", v, (unsigned long long)isto_rif[v]);
+        }
+    }
+    printf("%zu maschere a distanza <= %u; confronto con il kernel scalare: %zu errori\n",
+           c_rif, R, errori);
+
+    hdb_chiudi(&db);
+    free(d_rif);
+    free(d);
+    free(s_rif);
+    free(s);
+    return (0 == errori) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#endif
+/** EOF: HammingSIMD.c **/
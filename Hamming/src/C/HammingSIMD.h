@@ -0,0 +1,57 @@
+/**********************************************************************/
+/**********************************************************************/
+/*                                                                    */
+/* HammingSIMD.h - Bulk query-vs-dataset Hamming distance kernels     */
+/*                                                                    */
+/**********************************************************************/
+/* TECHGLISH: Public interface of HammingSIMD.c, for the programs     */
+/* that link it as a library (-DHAMMINGSIMD_LIB). The masks are a     */
+/* packed little-endian array with the .hdb layout (HammingDB.h), of  */
+/* 4 bytes (n <= 32) or 8 bytes each, e.g. hdb_classe(db, d). The     */
+/* kernel is chosen once by hd_init(), then every call uses it.       */
+/**********************************************************************/
+/* NERDYTALIAN: Interfaccia pubblica di HammingSIMD.c, per i          */
+/* programmi che lo collegano come libreria (-DHAMMINGSIMD_LIB). Le   */
+/* maschere sono un vettore impacchettato little-endian secondo il    */
+/* formato .hdb (HammingDB.h), di 4 byte (n <= 32) oppure 8 byte      */
+/* ciascuna, ad es. hdb_classe(db, d). Il kernel si sceglie una volta */
+/* con hd_init(), poi ogni chiamata lo utilizza.                      */
+/**********************************************************************/
+/**********************************************************************/
+
+#ifndef _HAMMING_SIMD_H_
+ #define _HAMMING_SIMD_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+** Seleziona il kernel: nome NULL per il migliore disponibile, oppure
+** "scalare", "AVX2", "AVX-512". Restituisce false se non e' supportato
+** dalla CPU, e in tal caso il kernel in uso non cambia. Prima della
+** prima chiamata e' attivo il kernel scalare.
+*/
+bool hd_init(const char* nome);
+
+// Nome del kernel in uso
+const char* hd_kernel(void);
+
+/*
+** Distanze di Hamming da q delle num maschere di dati, larghe
+** larghezza byte (4 oppure 8), in out[0..num-1].
+*/
+void hd_distanze(const uint8_t* dati, size_t larghezza, size_t num, uint64_t q, uint8_t* out);
+
+/*
+** Indici, in ordine crescente, delle maschere a distanza <= R da q in
+** out[], che deve avere posto per num elementi. Restituisce quante sono.
+*/
+size_t hd_soglia(const uint8_t* dati, size_t larghezza, size_t num, uint64_t q,
+                 unsigned R, uint32_t* out);
+
+// Istogramma delle distanze da q: isto[v] maschere a distanza v, 0 <= v <= 64
+void hd_istogramma(const uint8_t* dati, size_t larghezza, size_t num, uint64_t q,
+                   uint64_t isto[65]);
+
+#endif
+/** EOF: HammingSIMD.h **/
@@ -6,18 +6,18 @@
 /**********************************************************************/
 /* CODE METRICS:                                                      */
 /* Size metrics:                                                      */
-/*   - Lines of Code (LOC): 196                                       */
-/*   - Logical Lines of Code (LLOC): 142                              */
-/*   - Comment Lines: 54                                              */
-/*   - Comment-to-Code Ratio: 0.38                                    */
+/*   - Lines of Code (LOC): 1779                                      */
+/*   - Logical Lines of Code (LLOC): 810                              */
+/*   - Comment Lines: 418                                             */
+/*   - Comment-to-Code Ratio: 0.34                                    */
 /* Complexity metrics:                                                */
-/*   - Cyclomatic Complexity: 18                                      */
-/*   - Maximum Nesting Level: 3                                       */
-/*   - Maintainability Index: 74 (Good)                               */
+/*   - Cyclomatic Complexity: 333                                     */
+/*   - Maximum Nesting Level: 6                                       */
+/*   - Maintainability Index: 83 (Good)                               */
 /* Halstead metrics:                                                  */
-/*   - Program Volume (V): 3,856                                      */
-/*   - Program Difficulty (D): 35.2                                   */
-/*   - Development Time Estimate: 7.54 hours                          */
+/*   - Program Volume (V): 65,744                                     */
+/*   - Program Difficulty (D): 304.9                                  */
+/*   - Development Time Estimate: 1113.57 hours                       */
 /**********************************************************************/
 /* TECHGLISH: This implementation generates k-subsets of n-sets,      */
 /* classified by their Hamming distance from a reference subset.      */
@@ -40,116 +40,830 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include "HammingDB.h"
+#include "HammingBits.h"
+#include "Generators.h"
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
 
 /******************* TYPES AND CONSTANTS *************************/
-/* TECHGLISH: We represent sets as bit vectors using a 32-bit    */
-/* unsigned integer type. This limits the maximum universe size  */
-/* to 32 elements, which is sufficient for most applications.    */
+/* TECHGLISH: Sets are bit vectors of a width chosen at runtime  */
+/* from n: uint32_t up to 32 elements, uint64_t up to 64,        */
+/* unsigned __int128 up to 128 (where the compiler offers it)    */
+/* and a fixed-size multiword bitset up to MAX_N = 1024.         */
 /*                                                               */
-/* NERDYTALIAN: Rappresentiamo gli insiemi come vettori di bit   */
-/* utilizzando un tipo intero senza segno a 32 bit. Questo       */
-/* limita la dimensione massima dell'universo a 32 elementi,     */
-/* che e' sufficiente per la maggior parte delle applicazioni.   */
+/* NERDYTALIAN: Gli insiemi sono vettori di bit di larghezza     */
+/* scelta a runtime in base a n: uint32_t fino a 32 elementi,    */
+/* uint64_t fino a 64, unsigned __int128 fino a 128 (se il       */
+/* compilatore lo offre) e un bitset multiparola di dimensione   */
+/* fissa fino a MAX_N = 1024.                                    */
 /*****************************************************************/
 
-// Definizione del tipo per rappresentare l'insieme
-typedef uint32_t Set_t;
+// Tipi per rappresentare l'insieme, uno per ogni larghezza
+typedef uint32_t Set32_t;
+typedef uint64_t Set64_t;
+#if defined(__SIZEOF_INT128__)
+ #define HAVE_SET128
+typedef unsigned __int128 Set128_t;
+#endif
 
 // Pensiamo in grande, ma non troppo.
-// 32 bit saranno sufficienti, per ora!
-#define MAX_N 32
+// 1024 bit saranno sufficienti, per ora!
+#define MAX_N 1024
 
-// Totalizzatore insiemi generati
-size_t counter = 0;
+// Bitset multiparola: parole da 64 bit, la prima e' la meno significativa
+#define MW_WORDS (MAX_N / 64)
+typedef struct {
+    uint64_t w[MW_WORDS];
+} SetMW_t;
+
+// Totalizzatore insiemi generati, privato per ogni thread. A 64 bit
+// anche dove size_t ne ha 32: a un miliardo di subset al secondo
+// servirebbero secoli per esaurirlo
+uint64_t counter = 0;
+#ifdef _OPENMP
+ #pragma omp threadprivate(counter)
+#endif
 
 /******************* BIT MANIPULATION UTILITIES ******************/
 /* TECHGLISH: Efficient macros for bit manipulation operations.  */
 /* We use compiler-specific intrinsics when available for better */
 /* performance, with a fallback to standard bitwise operations.  */
+/* Every width gets the same set of primitives (prefix u32_,     */
+/* u64_, u128_, mw_), so that the generator below is written     */
+/* once and instantiated per width.                              */
 /*                                                               */
 /* NERDYTALIAN: Macro efficienti per operazioni di manipolazione */
 /* dei bit. Utilizziamo funzioni intrinseche specifiche del      */
 /* compilatore quando disponibili per prestazioni migliori, con  */
-/* un ripiego su operazioni bit a bit standard.                  */
+/* un ripiego su operazioni bit a bit standard. Ogni larghezza   */
+/* dispone delle stesse primitive (prefisso u32_, u64_, u128_,   */
+/* mw_), cosi' il generatore viene scritto una volta sola ed     */
+/* istanziato per ogni larghezza.                                */
 /*****************************************************************/
 
-// Una comoda macro per la stampa dei subset
-#define HAS_MORE_BITS(value, i) ((value) & ~((1U << ((i) + 1)) - 1))
+// CTZ64 e POPCNT64 provengono da HammingBits.h
+
+/*
+** Deposito ed estrazione di bit (BMI2): PDEP distribuisce i bit bassi
+** di x sulle posizioni a 1 di m, PEXT compatta i bit di x selezionati
+** da m. Servono a trasportare le maschere contigue di rimozione e di
+** aggiunta sui bit a 1 e a 0 di un sottoinsieme di riferimento
+** qualsiasi. Senza -mbmi2 (o /arch:AVX2) le istruzioni si scelgono a
+** runtime tramite CPUID, come in HammingSIMD.c, e il binario resta
+** eseguibile ovunque; il ripiego portabile costa O(popcount(m)).
+*/
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+ #include <immintrin.h>
+ #define PDEP64(x, m) _pdep_u64((x), (m))
+ #define PEXT64(x, m) _pext_u64((x), (m))
+ #define bmi2_init() ((void)0)
+#else
+static inline uint64_t pdep_portabile(uint64_t x, uint64_t m) {
+    uint64_t r = 0;
+    // Si salta ai bit a 1 di x, scartando altrettanti bit di m
+    while ((0 != x) && (0 != m)) {
+        const unsigned s = CTZ64(x);
+        for (unsigned i = 0; i < s; ++i) {
+            m &= m - 1;
+        }
+        r |= m & (~m + 1);
+        m &= m - 1;
+        x = (x >> s) >> 1;
+    }
+    return r;
+}
+
+static inline uint64_t pext_portabile(uint64_t x, uint64_t m) {
+    uint64_t r = 0;
+    for (uint64_t b = 1; 0 != m; b += b) {
+        if (x & m & (~m + 1)) {
+            r |= b;
+        }
+        m &= m - 1;
+    }
+    return r;
+}
+
+ #if defined(__x86_64__) || defined(_M_X64)
+  #include <immintrin.h>
+  #if defined(_MSC_VER)
+   #include <intrin.h>
+   #define TARGET_BMI2
+  #else
+   #define TARGET_BMI2 __attribute__((target("bmi2")))
+  #endif
+
+// Impostato da bmi2_init(): un salto ben predetto costa meno del ripiego
+static bool ha_bmi2 = false;
+
+TARGET_BMI2 static uint64_t pdep_bmi2(uint64_t x, uint64_t m) { return _pdep_u64(x, m); }
+TARGET_BMI2 static uint64_t pext_bmi2(uint64_t x, uint64_t m) { return _pext_u64(x, m); }
+
+static void bmi2_init(void) {
+  #if defined(_MSC_VER)
+    int r[4];
+    __cpuid(r, 0);
+    if (r[0] >= 7) {
+        __cpuidex(r, 7, 0);
+        ha_bmi2 = (r[1] >> 8) & 1;
+    }
+  #else
+    __builtin_cpu_init();
+    ha_bmi2 = __builtin_cpu_supports("bmi2");
+  #endif
+}
+
+  #define PDEP64(x, m) (ha_bmi2 ? pdep_bmi2((x), (m)) : pdep_portabile((x), (m)))
+  #define PEXT64(x, m) (ha_bmi2 ? pext_bmi2((x), (m)) : pext_portabile((x), (m)))
+ #else
+  #define PDEP64(x, m) pdep_portabile((x), (m))
+  #define PEXT64(x, m) pext_portabile((x), (m))
+  #define bmi2_init() ((void)0)
+ #endif
+#endif
+
+// Versioni multiparola: i bit di x sono consumati, o prodotti, in
+// sequenza continua attraverso le parole
+static void dep_words(const uint64_t* x, const uint64_t* m, uint64_t* r, size_t nw) {
+    size_t o = 0;
+    for (size_t j = 0; j < nw; ++j) {
+        const size_t c = POPCNT64(m[j]), q = o / 64, s = o % 64;
+        uint64_t bits = x[q] >> s;
+        if ((s > 0) && (s + c > 64)) {
+            bits |= x[q + 1] << (64 - s);
+        }
+        r[j] = PDEP64(bits, m[j]);
+        o += c;
+    }
+}
+
+static void ext_words(const uint64_t* x, const uint64_t* m, uint64_t* r, size_t nw) {
+    size_t o = 0;
+    memset(r, 0, nw * sizeof(uint64_t));
+    for (size_t j = 0; j < nw; ++j) {
+        const size_t c = POPCNT64(m[j]), q = o / 64, s = o % 64;
+        const uint64_t bits = PEXT64(x[j], m[j]);
+        r[q] |= bits << s;
+        if ((s > 0) && (s + c > 64)) {
+            r[q + 1] |= bits >> (64 - s);
+        }
+        o += c;
+    }
+}
+
+/*
+** Primitive per i tipi scalari. Nel successore di Gosper la divisione
+** per smallest, potenza di due, diventa uno shift di ctz(smallest):
+** indispensabile per __int128, dove la divisione e' una chiamata di
+** libreria.
+*/
+#define DEFINE_SCALAR_OPS(S, T, W)                                       \
+static inline T S##_low(size_t k) {                                      \
+    return (k >= (W)) ? (T)~(T)0 : (T)(((T)1 << k) - 1);                 \
+}                                                                        \
+static inline T S##_shl(T x, size_t k) { return (T)(x << k); }           \
+static inline T S##_or(T a, T b) { return a | b; }                       \
+static inline T S##_andnot(T a, T b) { return a & (T)~b; }               \
+static inline bool S##_test(T x, size_t i) { return (x >> i) & 1; }      \
+static inline bool S##_lt(T a, T b) { return a < b; }                    \
+static inline T S##_next(T subset, T limit) {                            \
+    T smallest, ripple, ones;                                            \
+    if (subset == 0 || subset >= limit)                                  \
+        return limit;                                                    \
+    smallest = subset & (T)(~subset + 1);                                \
+    ripple = subset + smallest;                                          \
+    ones = subset ^ ripple;                                              \
+    ones = (ones >> 2) >> S##_ctz(smallest);                             \
+    return ripple | ones;                                                \
+}
+
+static inline unsigned u32_ctz(Set32_t x) { return CTZ64(x); }
+static inline unsigned u64_ctz(Set64_t x) { return CTZ64(x); }
+DEFINE_SCALAR_OPS(u32, Set32_t, 32)
+DEFINE_SCALAR_OPS(u64, Set64_t, 64)
+
+#ifdef HAVE_SET128
+static inline unsigned u128_ctz(Set128_t x) {
+    uint64_t lo = (uint64_t)x;
+    return lo ? CTZ64(lo) : 64 + CTZ64((uint64_t)(x >> 64));
+}
+DEFINE_SCALAR_OPS(u128, Set128_t, 128)
+#endif
+
+// Primitive per il bitset multiparola
+static SetMW_t mw_low(size_t k) {
+    SetMW_t r;
+    for (size_t j = 0; j < MW_WORDS; ++j) {
+        size_t b = j * 64;
+        r.w[j] = (k >= b + 64) ? ~0ULL : ((k > b) ? (1ULL << (k - b)) - 1 : 0);
+    }
+    return r;
+}
+
+static SetMW_t mw_shl(SetMW_t x, size_t k) {
+    SetMW_t r;
+    const size_t q = k / 64, s = k % 64;
+    for (size_t j = MW_WORDS; j-- > 0; ) {
+        uint64_t hi = (j >= q) ? x.w[j - q] : 0;
+        uint64_t lo = (j >= q + 1) ? x.w[j - q - 1] : 0;
+        r.w[j] = s ? (hi << s) | (lo >> (64 - s)) : hi;
+    }
+    return r;
+}
+
+static SetMW_t mw_shr(SetMW_t x, size_t k) {
+    SetMW_t r;
+    const size_t q = k / 64, s = k % 64;
+    for (size_t j = 0; j < MW_WORDS; ++j) {
+        uint64_t lo = (j + q < MW_WORDS) ? x.w[j + q] : 0;
+        uint64_t hi = (j + q + 1 < MW_WORDS) ? x.w[j + q + 1] : 0;
+        r.w[j] = s ? (lo >> s) | (hi << (64 - s)) : lo;
+    }
+    return r;
+}
+
+static SetMW_t mw_or(SetMW_t a, SetMW_t b) {
+    for (size_t j = 0; j < MW_WORDS; ++j) {
+        a.w[j] |= b.w[j];
+    }
+    return a;
+}
+
+static SetMW_t mw_andnot(SetMW_t a, SetMW_t b) {
+    for (size_t j = 0; j < MW_WORDS; ++j) {
+        a.w[j] &= ~b.w[j];
+    }
+    return a;
+}
+
+static inline bool mw_test(SetMW_t x, size_t i) {
+    return (x.w[i / 64] >> (i % 64)) & 1;
+}
+
+static bool mw_lt(SetMW_t a, SetMW_t b) {
+    for (size_t j = MW_WORDS; j-- > 0; ) {
+        if (a.w[j] != b.w[j]) {
+            return a.w[j] < b.w[j];
+        }
+    }
+    return false;
+}
+
+// Gosper su piu' parole: somma con riporto e shift al posto della divisione
+static SetMW_t mw_next(SetMW_t subset, SetMW_t limit) {
+    SetMW_t ripple, ones;
+    size_t j = 0, p;
+    uint64_t c;
+
+    while ((j < MW_WORDS) && (0 == subset.w[j])) {
+        ++j;
+    }
+    if ((j == MW_WORDS) || !mw_lt(subset, limit)) {
+        return limit;
+    }
+    // Posizione del bit piu' a destra (LSB)
+    p = j * 64 + CTZ64(subset.w[j]);
+    // Propaga il riporto a partire dalla parola j
+    ripple = subset;
+    c = 1ULL << (p % 64);
+    for (; (j < MW_WORDS) && c; ++j) {
+        ripple.w[j] += c;
+        c = (ripple.w[j] < c) ? 1 : 0;
+    }
+    for (j = 0; j < MW_WORDS; ++j) {
+        ones.w[j] = subset.w[j] ^ ripple.w[j];
+    }
+    return mw_or(ripple, mw_shr(ones, p + 2));
+}
 
 /******************* OUTPUT FORMATTING FUNCTIONS *****************/
-/* TECHGLISH: Functions to display subsets in human-readable     */
-/* formats. print_set shows a subset in algebraic notation with  */
-/* elements as letters, while print_binary shows the bit vector  */
-/* representation along with metadata about the subset.          */
+/* TECHGLISH: Buffered output layer. Each subset is formatted    */
+/* into a large buffer, flushed with a single fwrite() when      */
+/* full: the bit vector goes through a 256-entry table mapping   */
+/* one byte to eight characters, the element list through a ctz  */
+/* loop over the set bits only. The text format is exactly the   */
+/* one of the former printf()-based print_binary/print_set: for  */
+/* n > 32 the elements are shown as decimal indices, since       */
+/* letters run out. In binary mode every subset is written as a  */
+/* raw little-endian mask of 4 bytes (n <= 32) or 8 * ceil(n/64) */
+/* bytes, with no text at all.                                   */
 /*                                                               */
-/* NERDYTALIAN: Funzioni per visualizzare i sottoinsiemi in      */
-/* formati leggibili. print_set mostra un sottoinsieme in        */
-/* notazione algebrica con elementi come lettere, mentre         */
-/* print_binary mostra la rappresentazione del vettore di bit    */
-/* insieme ai metadati sul sottoinsieme.                         */
+/* NERDYTALIAN: Livello di output bufferizzato. Ogni sottoinsieme*/
+/* viene formattato in un grande buffer, scaricato con una sola  */
+/* fwrite() quando e' pieno: il vettore di bit passa per una     */
+/* tabella di 256 voci che mappa un byte in otto caratteri, la   */
+/* lista degli elementi per un ciclo ctz sui soli bit a 1. Il    */
+/* formato testo e' esattamente quello delle precedenti          */
+/* print_binary/print_set basate su printf(): per n > 32 gli     */
+/* elementi sono indicati con indici decimali, dato che le       */
+/* lettere non bastano. In modalita' binaria ogni sottoinsieme   */
+/* viene scritto come maschera little-endian grezza di 4 byte    */
+/* (n <= 32) oppure 8 * ceil(n/64) byte, senza alcun testo.      */
 /*****************************************************************/
 
-// Funzione per la stampa di un sottoinsieme
-void print_set(Set_t value, size_t n) {
-    printf(" {");
-    for (char i = 0; i < n; ++i) {
-        if (value & (1 << i)) {
-            // Converte la posizione in carattere (a, b, c, ...)
-            printf("%c", 'a' + i); 
-            if (i < n - 1 && HAS_MORE_BITS(value, i)) {
-                // Aggiunge la virgola solo se ci sono altri elementi
-                printf(", "); 
-            }
+// Soglia oltre la quale gli elementi non sono piu' lettere
+#define MAX_N_LETTERE 32
+
+// Dimensione del buffer di output e spazio riservato per una riga
+#define OUT_BUF_SIZE  (1U << 20)
+#define OUT_MAX_RIGA  (8U * MAX_N)
+
+// Buffer del thread principale; i thread di lavoro ne allocano uno
+// proprio, cosi' come il proprio out_len
+static char   out_buf_main[OUT_BUF_SIZE];
+static char*  out_buf = out_buf_main;
+static size_t out_len = 0;
+#ifdef _OPENMP
+ #pragma omp threadprivate(out_buf, out_len)
+#endif
+static bool   out_binario = false;
+static FILE*  out_file = NULL;          // NULL: stdout
+
+// Tabella byte -> 8 caratteri '0'/'1', bit piu' significativo in testa
+static char bit_lut[256][8];
+static const char hex_lut[] = "0123456789ABCDEF";
+
+void out_init(bool binario) {
+    out_binario = binario;
+    for (size_t b = 0; b < 256; ++b) {
+        for (size_t i = 0; i < 8; ++i) {
+            bit_lut[b][i] = ((b >> (7 - i)) & 1) ? '1' : '0';
+        }
+    }
+}
+
+// Una sola fwrite() per buffer: e' atomica anche tra piu' thread
+static void out_flush(void) {
+    if (out_len > 0) {
+        fwrite(out_buf, 1, out_len, (NULL != out_file) ? out_file : stdout);
+        out_len = 0;
+    }
+}
+
+static inline void out_reserve(size_t len) {
+    if (out_len + len > OUT_BUF_SIZE) {
+        out_flush();
+    }
+}
+
+static void out_str(const char* s) {
+    size_t len = strlen(s);
+    out_reserve(len);
+    memcpy(out_buf + out_len, s, len);
+    out_len += len;
+}
+
+// Intero decimale allineato a destra su almeno width caratteri ("%*zu")
+static inline char* fmt_uint(char* p, uint64_t x, size_t width) {
+    char tmp[24];
+    size_t len = 0;
+    do {
+        tmp[len++] = (char)('0' + x % 10);
+        x /= 10;
+    } while (x > 0);
+    for (; width > len; --width) {
+        *p++ = ' ';
+    }
+    while (len > 0) {
+        *p++ = tmp[--len];
+    }
+    return p;
+}
+
+// Esadecimale: la parola piu' significativa non nulla con almeno
+// sei cifre (come "%06X" per uint32_t), le successive con sedici
+static char* fmt_hex(char* p, const uint64_t* w, size_t nw) {
+    size_t j = nw, cifre = 6;
+    uint64_t top;
+    while ((j > 1) && (0 == w[j - 1])) {
+        --j;
+    }
+    top = w[j - 1];
+    while ((cifre < 16) && (top >> (4 * cifre))) {
+        ++cifre;
+    }
+    while (cifre-- > 0) {
+        *p++ = hex_lut[(top >> (4 * cifre)) & 15];
+    }
+    while (j-- > 1) {
+        for (size_t c = 16; c-- > 0; ) {
+            *p++ = hex_lut[(w[j - 1] >> (4 * c)) & 15];
         }
     }
-    printf("}");
+    return p;
 }
 
-// Stampa il vettore caratteristico in hex e binario 
-void print_binary(Set_t value, size_t n, size_t d, bool prefix) {
-    Set_t v = value;
-    // Informazioni aggiuntive sul subset nella classe di distanza
+/*
+** Emette un sottoinsieme, dato come nw parole da 64 bit (la prima e'
+** la meno significativa). Con prefix si antepongono contatore,
+** distanza e valore esadecimale.
+*/
+static void emit_subset(const uint64_t* w, size_t nw, size_t n, size_t d, bool prefix) {
+    char* p;
+    bool primo = true;
+
+    if (out_binario) {
+        const size_t len = (n <= 32) ? 4 : 8 * ((n + 63) / 64);
+        out_reserve(len);
+        p = out_buf + out_len;
+        for (size_t b = 0; b < len; ++b) {
+            *p++ = (char)(w[b / 8] >> (8 * (b % 8)));
+        }
+        out_len += len;
+        return;
+    }
+
+    out_reserve(OUT_MAX_RIGA);
+    p = out_buf + out_len;
     if (prefix) {
-        printf("%4zu [%zu]: (%06X) ", counter, d, value);
+        p = fmt_uint(p, counter, 4);
+        *p++ = ' ';
+        *p++ = '[';
+        p = fmt_uint(p, d, 0);
+        *p++ = ']';
+        *p++ = ':';
+        *p++ = ' ';
+        *p++ = '(';
+        p = fmt_hex(p, w, nw);
+        *p++ = ')';
+        *p++ = ' ';
     }
-    
-    // Stampa il vettore booleano caratteristico
-    for (size_t i = n; i > 0; --i) {
-        printf("%c", (value & (1 << (i - 1))) ? '1' : '0');
+
+    // Vettore caratteristico: byte parziale in testa, poi byte interi
+    for (size_t i = n; i > 0; ) {
+        const size_t bit = (i - 1) & ~(size_t)7;
+        const uint8_t b = (uint8_t)(w[bit / 64] >> (bit % 64));
+        const size_t c = i - bit;
+        memcpy(p, bit_lut[b] + 8 - c, c);
+        p += c;
+        i = bit;
     }
-    
-    // Arricchisce l'output con una stampa del subset in formato simbolico
-    print_set(v, n);
-    puts("");
+
+    // Forma simbolica: solo i bit a 1, con la virgola tra gli elementi
+    *p++ = ' ';
+    *p++ = '{';
+    for (size_t j = 0; j < nw; ++j) {
+        uint64_t x = w[j];
+        while (0 != x) {
+            const size_t i = j * 64 + CTZ64(x);
+            x &= x - 1;
+            if (!primo) {
+                *p++ = ',';
+                *p++ = ' ';
+            }
+            primo = false;
+            if (n <= MAX_N_LETTERE) {
+                *p++ = (char)('a' + i);
+            } else {
+                p = fmt_uint(p, i, 0);
+            }
+        }
+    }
+    *p++ = '}';
+    *p++ = '\n';
+    out_len = (size_t)(p - out_buf);
 }
 
-/******************* SUBSET GENERATION ALGORITHM ******************/
-/* TECHGLISH: Gosper's algorithm for generating the next k-subset */
-/* in lexicographic order. This elegant bit manipulation algorithm*/
-/* directly computes the successor without iteration, providing   */
-/* optimal performance for combinatorial generation.              */
-/*                                                                */
-/* NERDYTALIAN: Algoritmo di Gosper per generare il prossimo      */
-/* k-sottoinsieme in ordine lessicografico. Questo elegante       */
-/* algoritmo di manipolazione dei bit calcola direttamente il     */
-/* successore senza iterazione, fornendo prestazioni ottimali     */
-/* per la generazione combinatoria.                               */
-/******************************************************************/
+// Conversione in parole da 64 bit per emit_subset()
+static inline size_t u32_words(Set32_t x, uint64_t* w) { w[0] = x; return 1; }
+static inline size_t u64_words(Set64_t x, uint64_t* w) { w[0] = x; return 1; }
+#ifdef HAVE_SET128
+static inline size_t u128_words(Set128_t x, uint64_t* w) {
+    w[0] = (uint64_t)x;
+    w[1] = (uint64_t)(x >> 64);
+    return 2;
+}
+#endif
+static inline size_t mw_words(SetMW_t x, uint64_t* w) {
+    memcpy(w, x.w, sizeof(x.w));
+    return MW_WORDS;
+}
 
-// Genera il successore del subset corrente
-Set_t next_subset(Set_t subset, Set_t limit) {
-    if (subset == 0 || subset >= limit)
-        return limit;
-    // Isola il bit piu' a destra (LSB)
-    Set_t smallest = subset & -subset;    
-    // Propaga il riporto    
-    Set_t ripple = subset + smallest;     
-    // Identifica i bit cambiati    
-    Set_t ones = subset ^ ripple;         
-    // Riposiziona i bit a 1    
-    ones = (ones >> 2) / smallest;        
-    // Ricombina il risultato con un OR   
-    return ripple | ones;                 
+// Conversione inversa, dalle parole da 64 bit al tipo insieme
+static inline Set32_t u32_from_words(const uint64_t* w) { return (Set32_t)w[0]; }
+static inline Set64_t u64_from_words(const uint64_t* w) { return w[0]; }
+#ifdef HAVE_SET128
+static inline Set128_t u128_from_words(const uint64_t* w) {
+    return ((Set128_t)w[1] << 64) | w[0];
+}
+#endif
+static inline SetMW_t mw_from_words(const uint64_t* w) {
+    SetMW_t x;
+    memcpy(x.w, w, sizeof(x.w));
+    return x;
+}
+
+/******************* REFERENCE SUBSET ****************************/
+/* TECHGLISH: Distances are measured from a reference k-subset,  */
+/* by default the canonical {0, 1, ..., k-1}. Any other k-subset */
+/* R can be chosen: the removal masks, contiguous on bits 0..k-1,*/
+/* are deposited with PDEP onto the set bits of R, the addition  */
+/* masks, contiguous on bits 0..n-k-1, onto its clear bits. With */
+/* BMI2 a deposit costs one instruction per word, so enumerating */
+/* around any reference costs the same as around the canonical   */
+/* one; PEXT does the inverse mapping for hamming_rank().        */
+/*                                                               */
+/* NERDYTALIAN: Le distanze sono misurate da un k-sottoinsieme di*/
+/* riferimento, per difetto quello canonico {0, 1, ..., k-1}. Si */
+/* puo' scegliere un qualsiasi altro k-sottoinsieme R: le        */
+/* maschere di rimozione, contigue sui bit 0..k-1, sono          */
+/* depositate con PDEP sui bit a 1 di R, quelle di aggiunta,     */
+/* contigue sui bit 0..n-k-1, sui suoi bit a 0. Con BMI2 un      */
+/* deposito costa un'istruzione per parola, quindi enumerare     */
+/* attorno a un riferimento qualsiasi costa quanto attorno a     */
+/* quello canonico; PEXT realizza la corrispondenza inversa per  */
+/* hamming_rank().                                               */
+/*****************************************************************/
+
+// Riferimento R, complemento di R in {0..n-1}, R == {0..k-1}:
+// nel caso canonico ref_set e ref_free non vengono consultati
+static uint64_t ref_set[MW_WORDS];
+static uint64_t ref_free[MW_WORDS];
+static bool     ref_canonica = true;
+
+/*
+** Imposta il sottoinsieme di riferimento (ceil(n/64) parole) per
+** universo n. Restituisce false se mask contiene elementi >= n.
+*/
+bool set_reference(const uint64_t* mask, size_t n) {
+    const size_t nw = (n + 63) / 64;
+    size_t k = 0;
+
+    bmi2_init();
+    for (size_t j = 0; j < MW_WORDS; ++j) {
+        const uint64_t in_n = (64 * j >= n) ? 0 :
+            ((n - 64 * j >= 64) ? ~0ULL : (1ULL << (n - 64 * j)) - 1);
+        const uint64_t x = (j < nw) ? mask[j] : 0;
+        if (x & ~in_n) {
+            return false;
+        }
+        ref_set[j] = x;
+        ref_free[j] = in_n & ~x;
+        k += POPCNT64(x);
+    }
+    // Canonico se i k bit a 1 sono i piu' bassi
+    ref_canonica = true;
+    for (size_t j = 0; j < MW_WORDS; ++j) {
+        const uint64_t low = (k >= 64 * j + 64) ? ~0ULL :
+            ((k > 64 * j) ? (1ULL << (k - 64 * j)) - 1 : 0);
+        ref_canonica = ref_canonica && (ref_set[j] == low);
+    }
+    return true;
+}
+
+// Deposito di x sui bit a 1 di m, per ogni larghezza
+static inline Set32_t u32_dep(Set32_t x, Set32_t m) { return (Set32_t)PDEP64(x, m); }
+static inline Set64_t u64_dep(Set64_t x, Set64_t m) { return PDEP64(x, m); }
+#ifdef HAVE_SET128
+static inline Set128_t u128_dep(Set128_t x, Set128_t m) {
+    uint64_t xw[2], mw[2], r[2];
+    u128_words(x, xw);
+    u128_words(m, mw);
+    dep_words(xw, mw, r, 2);
+    return u128_from_words(r);
+}
+#endif
+static inline SetMW_t mw_dep(SetMW_t x, SetMW_t m) {
+    SetMW_t r;
+    dep_words(x.w, m.w, r.w, MW_WORDS);
+    return r;
+}
+
+/******************* RANK AND UNRANK *****************************/
+/* TECHGLISH: The class at distance d is the Cartesian product   */
+/* of the C(k,d) removal masks (d positions out of the k of the  */
+/* base set) and of the C(n-k,d) addition masks (d positions out */
+/* of the remaining n-k). Gosper's algorithm visits both in      */
+/* colex order, i.e. by increasing numeric value, so the index   */
+/* of a subset inside its class is                               */
+/*     rank = rank(removal) * C(n-k,d) + rank(addition)          */
+/* where the colex rank of {c1 < c2 < ... < cd} is the sum of    */
+/* C(ci, i), the combinatorial number system. Binomials come     */
+/* from a Pascal table, saturated at UINT64_MAX. Rank costs O(k) */
+/* (plus one word scan per 64 elements), unrank O(k log n) with  */
+/* a binary search for each element. Ranks are meaningful only   */
+/* when the class size fits in 64 bits.                          */
+/*                                                               */
+/* NERDYTALIAN: La classe a distanza d e' il prodotto cartesiano */
+/* delle C(k,d) maschere di rimozione (d posizioni tra le k del  */
+/* sottoinsieme base) e delle C(n-k,d) maschere di aggiunta (d   */
+/* posizioni tra le restanti n-k). L'algoritmo di Gosper le      */
+/* visita entrambe in ordine colex, ossia per valore numerico    */
+/* crescente, quindi l'indice di un sottoinsieme nella classe e' */
+/*     rank = rank(rimozione) * C(n-k,d) + rank(aggiunta)        */
+/* dove il rango colex di {c1 < c2 < ... < cd} e' la somma dei   */
+/* C(ci, i), ossia il sistema numerico combinatorio. I binomiali */
+/* provengono da una tabella di Pascal, saturata a UINT64_MAX.   */
+/* Il rango costa O(k) (piu' una scansione ogni 64 elementi),    */
+/* l'operazione inversa O(k log n) con una ricerca binaria per   */
+/* ogni elemento. I ranghi hanno senso solo se la cardinalita'   */
+/* della classe sta in 64 bit.                                   */
+/*****************************************************************/
+
+// Valore restituito da hamming_rank() per maschere non valide
+#define HAMMING_RANK_INVALID UINT64_MAX
+
+// Tabella di Pascal saturata, per colonne: binom_tab[j][i] = C(i, j)
+// con i <= MAX_N e j <= MAX_N/2. Le ricerche binarie di unrank
+// scorrono una colonna, che cosi' e' contigua in memoria.
+static uint64_t binom_tab[MAX_N / 2 + 1][MAX_N + 1];
+static size_t   binom_righe = 0;
+
+static inline uint64_t sat_add(uint64_t a, uint64_t b) {
+    return (a > UINT64_MAX - b) ? UINT64_MAX : a + b;
+}
+
+static inline uint64_t sat_mul(uint64_t a, uint64_t b) {
+    return (a != 0 && b > UINT64_MAX / a) ? UINT64_MAX : a * b;
+}
+
+// Estende la tabella fino alla riga n, una volta sola
+static void binom_init(size_t n) {
+    for (size_t i = binom_righe; i <= n; ++i) {
+        binom_tab[0][i] = 1;
+        for (size_t j = 1; j <= MAX_N / 2; ++j) {
+            binom_tab[j][i] = (i == 0) ? 0 :
+                sat_add(binom_tab[j - 1][i - 1], binom_tab[j][i - 1]);
+        }
+    }
+    if (n + 1 > binom_righe) {
+        binom_righe = n + 1;
+    }
+}
+
+static inline uint64_t binom(size_t i, size_t j) {
+    return (j > i) ? 0 : binom_tab[j][i];
+}
+
+// Parametri ammessi dalle funzioni pubbliche: la tabella di Pascal
+// copre solo n <= MAX_N e 2k <= n, con d <= k
+static bool classe_valida(size_t n, size_t k, size_t d) {
+    return (n <= MAX_N) && (2 * k <= n) && (d <= k);
+}
+
+// Cardinalita' della classe d: C(k,d) * C(n-k,d), saturata; 0 se i
+// parametri non sono validi
+uint64_t hamming_class_size(size_t n, size_t k, size_t d) {
+    if (!classe_valida(n, k, d)) {
+        return 0;
+    }
+    binom_init(n);
+    return sat_mul(binom(k, d), binom(n - k, d));
+}
+
+/*
+** Rango del sottoinsieme mask (ceil(n/64) parole, la prima e' la meno
+** significativa) nella classe a distanza d, nell'ordine di
+** generate_k_subset(). Restituisce HAMMING_RANK_INVALID se mask non
+** ha esattamente k elementi a distanza d dal sottoinsieme base, o se
+** n, k, d non sono validi.
+*/
+uint64_t hamming_rank(const uint64_t* mask, size_t n, size_t k, size_t d) {
+    uint64_t r_rem = 0, r_add = 0, canonica[MW_WORDS];
+    size_t i_rem = 0, i_add = 0;
+
+    if (!classe_valida(n, k, d)) {
+        return HAMMING_RANK_INVALID;
+    }
+    binom_init(n);
+    // Riferimento qualsiasi: PEXT riporta mask alla forma canonica,
+    // elementi di R sui bit 0..k-1, gli altri sui bit k..n-1
+    if (!ref_canonica) {
+        const size_t nw = (n + 63) / 64, q = k / 64, s = k % 64;
+        uint64_t add[MW_WORDS];
+        for (size_t j = 0; j < MW_WORDS; ++j) {
+            if (((j < nw) ? mask[j] : 0) & ~(ref_set[j] | ref_free[j])) {
+                return HAMMING_RANK_INVALID;
+            }
+        }
+        ext_words(mask, ref_set, canonica, nw);
+        ext_words(mask, ref_free, add, nw);
+        // Aggiunte traslate di k posizioni
+        for (size_t j = 0; j + q < nw; ++j) {
+            canonica[j + q] |= add[j] << s;
+            if ((s > 0) && (j + q + 1 < nw)) {
+                canonica[j + q + 1] |= add[j] >> (64 - s);
+            }
+        }
+        mask = canonica;
+    }
+    // Rimozioni: posizioni a 0 tra le prime k
+    for (size_t j = 0; 64 * j < k; ++j) {
+        const size_t b = 64 * j;
+        uint64_t x = ~mask[j];
+        if (k - b < 64) {
+            x &= (1ULL << (k - b)) - 1;
+        }
+        while (0 != x) {
+            const size_t c = b + CTZ64(x);
+            x &= x - 1;
+            if (++i_rem > d) {
+                return HAMMING_RANK_INVALID;
+            }
+            r_rem += binom(c, i_rem);
+        }
+    }
+    // Aggiunte: posizioni a 1 tra k e n - 1
+    for (size_t j = k / 64; 64 * j < n; ++j) {
+        const size_t b = 64 * j;
+        uint64_t x = mask[j];
+        if (k > b) {
+            x &= ~((1ULL << (k - b)) - 1);
+        }
+        if (n - b < 64) {
+            x &= (1ULL << (n - b)) - 1;
+        }
+        while (0 != x) {
+            const size_t c = b + CTZ64(x) - k;
+            x &= x - 1;
+            if (++i_add > d) {
+                return HAMMING_RANK_INVALID;
+            }
+            r_add += binom(c, i_add);
+        }
+    }
+    if ((i_rem != d) || (i_add != d)) {
+        return HAMMING_RANK_INVALID;
+    }
+    return r_rem * binom(n - k, d) + r_add;
+}
+
+/*
+** Inverso colex: d posizioni tra 0 e m - 1 di rango r, come maschera
+** di parole. Per ogni i da d a 1 si cerca il massimo c con C(c,i) <= r.
+*/
+static void colex_unrank(uint64_t r, size_t m, size_t d, uint64_t* w) {
+    memset(w, 0, MW_WORDS * sizeof(uint64_t));
+    for (size_t i = d; i > 0; --i) {
+        // Ricerca binaria senza salti condizionali su [i - 1, m - 1]
+        const uint64_t* col = binom_tab[i];
+        size_t lo = i - 1, len = m - lo;
+        while (len > 1) {
+            const size_t half = len / 2;
+            lo = (col[lo + half] <= r) ? lo + half : lo;
+            len -= half;
+        }
+        r -= col[lo];
+        w[lo / 64] |= 1ULL << (lo % 64);
+        m = lo;
+    }
+}
+
+/*
+** Maschere di rimozione e di aggiunta (non traslata) dell'elemento
+** di indice idx della classe d: lo stato interno di generate_k_subset().
+*/
+static bool hamming_unrank_masks(uint64_t idx, size_t n, size_t k, size_t d,
+                                 uint64_t* rem, uint64_t* add) {
+    uint64_t n_add;
+
+    if (idx >= hamming_class_size(n, k, d)) {
+        return false;
+    }
+    n_add = binom(n - k, d);
+    colex_unrank(idx / n_add, k, d, rem);
+    colex_unrank(idx % n_add, n - k, d, add);
+    return true;
+}
+
+/*
+** Sottoinsieme di indice idx nella classe d, scritto in mask
+** (MW_WORDS parole). Restituisce false se idx e' fuori dalla classe
+** o se n, k, d non sono validi.
+*/
+bool hamming_unrank(uint64_t idx, size_t n, size_t k, size_t d, uint64_t* mask) {
+    uint64_t rem[MW_WORDS], add[MW_WORDS];
+
+    if (!hamming_unrank_masks(idx, n, k, d, rem, add)) {
+        return false;
+    }
+    // Riferimento qualsiasi: R meno le rimozioni, piu' le aggiunte
+    if (!ref_canonica) {
+        uint64_t r[MW_WORDS], a[MW_WORDS];
+        dep_words(rem, ref_set, r, MW_WORDS);
+        dep_words(add, ref_free, a, MW_WORDS);
+        for (size_t j = 0; j < MW_WORDS; ++j) {
+            mask[j] = (ref_set[j] & ~r[j]) | a[j];
+        }
+        return true;
+    }
+    memset(mask, 0, MW_WORDS * sizeof(uint64_t));
+    for (size_t c = 0; c < k; ++c) {
+        if (0 == ((rem[c / 64] >> (c % 64)) & 1)) {
+            mask[c / 64] |= 1ULL << (c % 64);
+        }
+    }
+    for (size_t j = 0; j < MW_WORDS; ++j) {
+        uint64_t x = add[j];
+        while (0 != x) {
+            const size_t c = 64 * j + CTZ64(x) + k;
+            x &= x - 1;
+            mask[c / 64] |= 1ULL << (c % 64);
+        }
+    }
+    return true;
 }
 
 /******************* HAMMING DISTANCE GENERATION ******************/
@@ -157,58 +871,443 @@ Set_t next_subset(Set_t subset, Set_t limit) {
 /* specific Hamming distance d from a reference subset. The       */
 /* algorithm works by systematically removing d elements from     */
 /* the base subset and adding d new elements, exploring all       */
-/* possible combinations of additions and removals.               */
+/* possible combinations of additions and removals. The masks     */
+/* advance with Gosper's algorithm, which computes the next       */
+/* k-subset in lexicographic order directly from the current     */
+/* one. DEFINE_HAMMING instantiates the generator for one width.  */
 /*                                                                */
 /* NERDYTALIAN: Questa funzione fondamentale genera tutti i       */
 /* k-sottoinsiemi a una distanza di Hamming d specifica da un     */
 /* sottoinsieme di riferimento. L'algoritmo funziona rimuovendo   */
 /* sistematicamente d elementi dal sottoinsieme base e aggiungendo*/
 /* d nuovi elementi, esplorando tutte le possibili combinazioni   */
-/* di aggiunte e rimozioni.                                       */
+/* di aggiunte e rimozioni. Le maschere avanzano con l'algoritmo  */
+/* di Gosper, che calcola direttamente il successore nell'ordine  */
+/* lessicografico. DEFINE_HAMMING istanzia il generatore per una  */
+/* data larghezza.                                                */
 /******************************************************************/
 
-// Funzione per generare k-subset a distanza desiderata
-void generate_k_subset(size_t n, size_t k, size_t d) {
-    // Crea base: subset = {0,1,...,k-1}    
-    Set_t base_set = (1 << k) - 1;        
-    // Set differenza (complemento)    
-    Set_t diff_set = (1 << (n - k)) - 1;  
-    // Maschera iniziale per d bit    
-    Set_t base_mask = (1 << d) - 1;       
-
-    if (d == 0) {
-        counter = 0;
-        printf("** Base set: ");
-        print_binary(base_set, n, d, false);
-        return;
+// Visitatore_t, con il sottoinsieme come parole da 64 bit: vedi Generators.h
+
+// Visitatore di stampa, per il livello di output: ctx punta a n
+static bool visita_stampa(const uint64_t* w, size_t nw, size_t d, void* ctx) {
+    emit_subset(w, nw, *(const size_t*)ctx, d, true);
+    return true;
+}
+
+#define DEFINE_HAMMING(S, T)                                             \
+/* Emette il sottoinsieme tramite il livello di output bufferizzato */   \
+static inline void print_binary_##S(T value, size_t n, size_t d,         \
+                                    bool prefix) {                       \
+    uint64_t w[MW_WORDS];                                                \
+    size_t nw = S##_words(value, w);                                     \
+    emit_subset(w, nw, n, d, prefix);                                    \
+}                                                                        \
+                                                                         \
+/* Visita count k-subset a distanza d a partire dall'indice first */   \
+static bool visit_k_subset_range_##S(size_t n, size_t k, size_t d,       \
+                                     uint64_t first, uint64_t count,     \
+                                     Visitatore_t visita, void* ctx) {   \
+    uint64_t rem[MW_WORDS], add[MW_WORDS], w[MW_WORDS];                  \
+    /* Base: il riferimento R, per difetto {0,1,...,k-1} */              \
+    const bool canonica = ref_canonica;                                  \
+    const T base_set = canonica ? S##_low(k) : S##_from_words(ref_set);  \
+    const T free_set = canonica ? S##_low(0) : S##_from_words(ref_free); \
+    /* Limiti per le maschere di rimozione e di aggiunta */              \
+    const T base_limit = S##_shl(S##_low(1), k);                         \
+    const T diff_limit = S##_shl(S##_low(1), n - k);                     \
+    T base_mask, diff_mask;                                              \
+                                                                         \
+    /* Posiziona le maschere sull'elemento di indice first */            \
+    if ((d == 0) || !hamming_unrank_masks(first, n, k, d, rem, add)) {   \
+        return true;                                                     \
+    }                                                                    \
+    base_mask = S##_from_words(rem);                                     \
+    diff_mask = S##_from_words(add);                                     \
+                                                                         \
+    while ((count > 0) && S##_lt(base_mask, base_limit)) {               \
+        /* Rimuovi d elementi, depositati sui bit a 1 di R */            \
+        const T modified_base = S##_andnot(base_set, canonica ?          \
+            base_mask : S##_dep(base_mask, base_set));                   \
+        while ((count > 0) && S##_lt(diff_mask, diff_limit)) {           \
+            /* Aggiungi d nuovi elementi, sui bit a 0 di R, con OR */    \
+            T result = S##_or(modified_base, canonica ?                  \
+                S##_shl(diff_mask, k) : S##_dep(diff_mask, free_set));   \
+            ++counter;                                                   \
+            --count;                                                     \
+            if (!visita(w, S##_words(result, w), d, ctx)) {              \
+                return false;                                            \
+            }                                                            \
+            /* Prossima maschera */                                      \
+            diff_mask = S##_next(diff_mask, diff_limit);                 \
+        }                                                                \
+        /* Prossima combinazione di bit da rimuovere */                  \
+        base_mask = S##_next(base_mask, base_limit);                     \
+        diff_mask = S##_low(d);                                          \
+    }                                                                    \
+    return true;                                                         \
+}                                                                        \
+                                                                         \
+/* Funzione per generare k-subset a distanza desiderata */               \
+static void generate_k_subset_##S(size_t n, size_t k, size_t d) {        \
+    if (d == 0) {                                                        \
+        counter = 0;                                                     \
+        if (!out_binario) {                                              \
+            out_str("** Base set: ");                                    \
+        }                                                                \
+        print_binary_##S(ref_canonica ? S##_low(k) :                     \
+                         S##_from_words(ref_set), n, d, false);          \
+        return;                                                          \
+    }                                                                    \
+                                                                         \
+    if (d > k) {                                                         \
+        out_str("Distanza non valida: d deve essere <= k.\n");           \
+        return;                                                          \
+    }                                                                    \
+                                                                         \
+    visit_k_subset_range_##S(n, k, d, 0, UINT64_MAX, visita_stampa, &n); \
+}
+
+DEFINE_HAMMING(u32, Set32_t)
+DEFINE_HAMMING(u64, Set64_t)
+#ifdef HAVE_SET128
+DEFINE_HAMMING(u128, Set128_t)
+#endif
+DEFINE_HAMMING(mw, SetMW_t)
+
+/*
+** Visita count k-subset della classe d a partire da quello di indice
+** first, senza stampa. Restituisce false se il visitatore ha
+** interrotto la visita o se n, k, d non sono validi.
+*/
+bool visit_k_subset_range(size_t n, size_t k, size_t d, uint64_t first,
+                          uint64_t count, Visitatore_t visita, void* ctx) {
+    if (!classe_valida(n, k, d)) {
+        fprintf(stderr, "Errore: parametri non validi (n = %zu, k = %zu, d = %zu).\n",
+                n, k, d);
+        return false;
+    }
+    if (n <= 32) {
+        return visit_k_subset_range_u32(n, k, d, first, count, visita, ctx);
+    } else if (n <= 64) {
+        return visit_k_subset_range_u64(n, k, d, first, count, visita, ctx);
+#ifdef HAVE_SET128
+    } else if (n <= 128) {
+        return visit_k_subset_range_u128(n, k, d, first, count, visita, ctx);
+#endif
     }
+    return visit_k_subset_range_mw(n, k, d, first, count, visita, ctx);
+}
 
-    if (d > k) {
-        printf("Distanza non valida: d deve essere <= k.\n");
-        return;
+/*
+** Ripresa di un'esecuzione interrotta o ripartizione di una classe
+** tra piu' processi: genera count k-subset della classe d a partire
+** da quello di indice first (vedi hamming_rank()).
+*/
+void generate_k_subset_range(size_t n, size_t k, size_t d,
+                             uint64_t first, uint64_t count) {
+    visit_k_subset_range(n, k, d, first, count, visita_stampa, &n);
+}
+
+/******************* PARALLEL GENERATION *************************/
+/* TECHGLISH: The class at distance d is split into index ranges */
+/* by means of hamming_unrank(), and the ranges are generated by */
+/* an OpenMP thread team. Every thread owns its output buffer    */
+/* and its counter (threadprivate), started at the serial index  */
+/* of the first subset of its range, so each line carries the    */
+/* same number as in the serial run. In ordered mode the class   */
+/* is cut into blocks that fit a buffer, written back in index   */
+/* order by an ordered section: the output is byte-identical to  */
+/* the serial one. In free mode each thread takes one contiguous */
+/* range and flushes whenever its buffer is full: lines stay     */
+/* intact but whole buffers interleave. Without OpenMP both      */
+/* modes fall back to a single thread.                           */
+/*                                                               */
+/* NERDYTALIAN: La classe a distanza d viene suddivisa in        */
+/* intervalli di indici tramite hamming_unrank(), e gli          */
+/* intervalli sono generati da un team di thread OpenMP. Ogni    */
+/* thread possiede il proprio buffer di output e il proprio      */
+/* contatore (threadprivate), fatto partire dall'indice seriale  */
+/* del primo sottoinsieme del suo intervallo, cosi' ogni riga    */
+/* porta lo stesso numero dell'esecuzione seriale. In modalita'  */
+/* ordinata la classe e' tagliata in blocchi che stanno in un    */
+/* buffer, riscritti in ordine di indice da una sezione ordered: */
+/* l'output e' identico byte per byte a quello seriale. In       */
+/* modalita' libera ogni thread prende un intervallo contiguo e  */
+/* scarica il buffer quando e' pieno: le righe restano intere ma */
+/* i buffer si alternano. Senza OpenMP entrambe le modalita'     */
+/* ricadono su un solo thread.                                   */
+/*****************************************************************/
+
+// Modalita' di generazione
+#define PAR_SERIALE  0
+#define PAR_ORDINATO 1
+#define PAR_LIBERO   2
+
+static int par_modo = PAR_SERIALE;
+
+// Maggiorazione della lunghezza di una riga di output per n e k
+static size_t riga_max(size_t n, size_t k) {
+    if (out_binario) {
+        return (n <= 32) ? 4 : 8 * ((n + 63) / 64);
     }
+    // Contatore e distanza, esadecimale, vettore di bit, elementi
+    return 40 + 16 * ((n + 63) / 64) + n + 6 * k;
+}
+
+void generate_k_subset_par(size_t n, size_t k, size_t d, bool ordinato) {
+    // Unica sezione seriale: la tabella dei binomiali viene poi
+    // soltanto letta dai thread
+    const uint64_t tot = hamming_class_size(n, k, d);
+    const uint64_t blocco = (OUT_BUF_SIZE - OUT_MAX_RIGA) / riga_max(n, k);
+    const long long nblocchi = (long long)((tot + blocco - 1) / blocco);
+    const uint64_t base = counter;
+    bool ok = true;
+
+    // Quanto gia' nel buffer precede la classe
+    out_flush();
+
+#ifdef _OPENMP
+    #pragma omp parallel reduction(&&:ok)
+#endif
+    {
+        size_t nt = 1, id = 0;
+#ifdef _OPENMP
+        nt = (size_t)omp_get_num_threads();
+        id = (size_t)omp_get_thread_num();
+#endif
+        if (0 != id) {
+            out_buf = (char *)malloc(OUT_BUF_SIZE);
+            out_len = 0;
+            ok = (NULL != out_buf);
+        }
 
-    while (base_mask < (1 << k)) {
-        Set_t diff_mask = (1 << d) - 1;
-        while (diff_mask < (1 << (n - k))) {
-            // Rimuovi d elementi
-            Set_t modified_base = base_set & ~base_mask;  
-            // Aggiungi d nuovi elementi
-            Set_t shifted_diff = diff_mask << k;   
-            // Ricombina i valori con OR       
-            Set_t result = modified_base | shifted_diff;  
-            ++counter;            
-            print_binary(result, n, d, true);
-            // Prossima maschera
-            diff_mask = next_subset(diff_mask, (1 << (n - k))); 
-            if (counter == SIZE_MAX) {
-                fprintf(stderr, "Errore: raggiunto il limite massimo di conteggio. Terminazione.\n");
-                exit(EXIT_FAILURE);
+        if (ordinato) {
+#ifdef _OPENMP
+            #pragma omp for ordered schedule(static, 1)
+#endif
+            for (long long b = 0; b < nblocchi; ++b) {
+                const uint64_t first = (uint64_t)b * blocco;
+                if (ok) {
+                    counter = base + first;
+                    generate_k_subset_range(n, k, d, first, blocco);
+                }
+#ifdef _OPENMP
+                #pragma omp ordered
+#endif
+                out_flush();
             }
+        } else if (ok) {
+            const uint64_t first = tot / nt * id + ((id < tot % nt) ? id : tot % nt);
+            const uint64_t count = tot / nt + ((id < tot % nt) ? 1 : 0);
+            counter = base + first;
+            generate_k_subset_range(n, k, d, first, count);
+            out_flush();
+        }
+
+        if (0 != id) {
+            free(out_buf);
+            out_buf = out_buf_main;
+        }
+    }
+
+    if (!ok) {
+        fputs("Errore di allocazione!\n", stderr);
+        exit(EXIT_FAILURE);
+    }
+    counter = base + tot;
+}
+
+// Dispatch a runtime sulla larghezza minima sufficiente per n
+void generate_k_subset(size_t n, size_t k, size_t d) {
+    if ((PAR_SERIALE != par_modo) && (d > 0) && (d <= k)) {
+        generate_k_subset_par(n, k, d, PAR_ORDINATO == par_modo);
+    } else if (n <= 32) {
+        generate_k_subset_u32(n, k, d);
+    } else if (n <= 64) {
+        generate_k_subset_u64(n, k, d);
+#ifdef HAVE_SET128
+    } else if (n <= 128) {
+        generate_k_subset_u128(n, k, d);
+#endif
+    } else {
+        generate_k_subset_mw(n, k, d);
+    }
+}
+
+/******************* COUNTING AND HAMMING BALLS ******************/
+/* TECHGLISH: The size of the class at distance d is known in    */
+/* closed form, C(k,d) * C(n-k,d), and the Hamming ball of radius*/
+/* r around the reference is the union of the classes 0..r: no   */
+/* enumeration is needed to count them. With n up to 1024 the    */
+/* counts reach C(1024,512), about 2^1020, far beyond 64 or 128  */
+/* bits: a minimal unsigned big integer in 32-bit limbs is used, */
+/* with exact binomials from the multiplicative formula. The     */
+/* streaming ball enumerator visits the classes 0..r through a   */
+/* visitor, with no printing at all.                             */
+/*                                                               */
+/* NERDYTALIAN: La cardinalita' della classe a distanza d e' nota*/
+/* in forma chiusa, C(k,d) * C(n-k,d), e la palla di Hamming di  */
+/* raggio r attorno al riferimento e' l'unione delle classi      */
+/* 0..r: per contarle non serve alcuna enumerazione. Con n fino  */
+/* a 1024 i conteggi arrivano a C(1024,512), circa 2^1020, ben   */
+/* oltre 64 o 128 bit: si usa un intero senza segno a precisione */
+/* multipla minimale in parole da 32 bit, con binomiali esatti   */
+/* dalla formula moltiplicativa. L'enumeratore della palla       */
+/* visita le classi 0..r tramite un visitatore, senza stampare.  */
+/*****************************************************************/
+
+// 34 parole da 32 bit: 1088 bit, sufficienti per C(1024,512) * 1024,
+// il massimo valore intermedio del calcolo dei binomiali
+#define BIG_LIMBS 34
+
+typedef struct {
+    uint32_t l[BIG_LIMBS];      // Parola meno significativa in testa
+    size_t   len;               // Parole significative, 0 per lo zero
+} Big_t;
+
+static void big_set(Big_t* a, uint32_t x) {
+    memset(a, 0, sizeof(*a));
+    a->l[0] = x;
+    a->len = (0 != x) ? 1 : 0;
+}
+
+static void big_mul_small(Big_t* a, uint32_t m) {
+    uint64_t c = 0;
+    for (size_t i = 0; i < a->len; ++i) {
+        c += (uint64_t)a->l[i] * m;
+        a->l[i] = (uint32_t)c;
+        c >>= 32;
+    }
+    if ((0 != c) && (a->len < BIG_LIMBS)) {
+        a->l[a->len++] = (uint32_t)c;
+    }
+}
+
+// Divisione per un intero piccolo; restituisce il resto
+static uint32_t big_div_small(Big_t* a, uint32_t m) {
+    uint64_t r = 0;
+    for (size_t i = a->len; i-- > 0; ) {
+        r = (r << 32) | a->l[i];
+        a->l[i] = (uint32_t)(r / m);
+        r %= m;
+    }
+    while ((a->len > 0) && (0 == a->l[a->len - 1])) {
+        --a->len;
+    }
+    return (uint32_t)r;
+}
+
+static void big_add(Big_t* a, const Big_t* b) {
+    uint64_t c = 0;
+    size_t len = (a->len > b->len) ? a->len : b->len;
+    for (size_t i = 0; i < len; ++i) {
+        c += (uint64_t)a->l[i] + b->l[i];
+        a->l[i] = (uint32_t)c;
+        c >>= 32;
+    }
+    if ((0 != c) && (len < BIG_LIMBS)) {
+        a->l[len++] = (uint32_t)c;
+    }
+    a->len = len;
+}
+
+static void big_mul(const Big_t* a, const Big_t* b, Big_t* r) {
+    memset(r, 0, sizeof(*r));
+    for (size_t i = 0; i < a->len; ++i) {
+        uint64_t c = 0;
+        for (size_t j = 0; (j < b->len) && (i + j < BIG_LIMBS); ++j) {
+            c += (uint64_t)a->l[i] * b->l[j] + r->l[i + j];
+            r->l[i + j] = (uint32_t)c;
+            c >>= 32;
+        }
+        if ((0 != c) && (i + b->len < BIG_LIMBS)) {
+            r->l[i + b->len] = (uint32_t)c;
+        }
+    }
+    r->len = (a->len + b->len < BIG_LIMBS) ? a->len + b->len : BIG_LIMBS;
+    while ((r->len > 0) && (0 == r->l[r->len - 1])) {
+        --r->len;
+    }
+}
+
+// Conversione in decimale, a blocchi di nove cifre
+char* big_str(const Big_t* a, char* buf, size_t size) {
+    Big_t t = *a;
+    uint32_t blocchi[BIG_LIMBS * 10 / 9 + 2];
+    size_t nb = 0;
+    char* p = buf;
+
+    do {
+        blocchi[nb++] = big_div_small(&t, 1000000000U);
+    } while (t.len > 0);
+    p += snprintf(p, size, "%u", blocchi[--nb]);
+    while (nb-- > 0) {
+        p += snprintf(p, size - (size_t)(p - buf), "%09u", blocchi[nb]);
+    }
+    return buf;
+}
+
+// C(m, j) esatto: dopo il passo i il valore e' C(m - j + i, i)
+static void big_binom(size_t m, size_t j, Big_t* r) {
+    big_set(r, (j <= m) ? 1 : 0);
+    if (j > m - j) {
+        j = m - j;
+    }
+    for (size_t i = 1; (j <= m) && (i <= j); ++i) {
+        big_mul_small(r, (uint32_t)(m - j + i));
+        big_div_small(r, (uint32_t)i);
+    }
+}
+
+// Cardinalita' esatta della classe d: C(k,d) * C(n-k,d)
+void hamming_class_count(size_t n, size_t k, size_t d, Big_t* r) {
+    Big_t a, b;
+    big_binom(k, d, &a);
+    big_binom(n - k, d, &b);
+    big_mul(&a, &b, r);
+}
+
+// Cardinalita' esatta della palla di raggio r: classi 0..r
+void hamming_ball_count(size_t n, size_t k, size_t r, Big_t* tot) {
+    Big_t c;
+    big_set(tot, 0);
+    for (size_t d = 0; (d <= r) && (d <= k); ++d) {
+        hamming_class_count(n, k, d, &c);
+        big_add(tot, &c);
+    }
+}
+
+/*
+** Enumerazione in streaming della palla di raggio r attorno al
+** riferimento: il riferimento stesso, poi le classi 1..r in ordine,
+** ciascun sottoinsieme passato al visitatore. Restituisce false se
+** il visitatore ha interrotto la visita o se n, k non sono validi.
+*/
+bool hamming_ball_visit(size_t n, size_t k, size_t r,
+                        Visitatore_t visita, void* ctx) {
+    uint64_t w[MW_WORDS] = {0};
+
+    if (!classe_valida(n, k, 0)) {
+        fprintf(stderr, "Errore: parametri non validi (n = %zu, k = %zu).\n", n, k);
+        return false;
+    }
+    if (ref_canonica) {
+        for (size_t i = 0; i < k; ++i) {
+            w[i / 64] |= 1ULL << (i % 64);
+        }
+    } else {
+        memcpy(w, ref_set, sizeof(w));
+    }
+    if (!visita(w, (n + 63) / 64, 0, ctx)) {
+        return false;
+    }
+    for (size_t d = 1; (d <= r) && (d <= k); ++d) {
+        if (!visit_k_subset_range(n, k, d, 0, UINT64_MAX, visita, ctx)) {
+            return false;
         }
-        // Prossima combinazione di bit da rimuovere
-        base_mask = next_subset(base_mask, (1 << k)); 
     }
+    return true;
 }
 
 /******************* COMPLETE SUBSET GENERATION ******************/
@@ -226,8 +1325,12 @@ void generate_k_subset(size_t n, size_t k, size_t d) {
 
 // Generazione esaustiva di tutti i k-subset con 0 <= d <= k
 void generate_all_subsets(size_t n, size_t k) {
+    char riga[64];
     for (size_t d = 0; d <= k; ++d) {
-        printf("\n=== d = %zu ===\n", d);
+        if (!out_binario) {
+            snprintf(riga, sizeof(riga), "\n=== d = %zu ===\n", d);
+            out_str(riga);
+        }
         generate_k_subset(n, k, d);
     }
 }
@@ -247,19 +1350,314 @@ void generate_all_subsets(size_t n, size_t k) {
 /* di tutti i sottoinsiemi per distanza.                           */
 /*******************************************************************/
 
+#if defined(HAMMING_RANK_TEST)
+/*
+** Collaudo di hamming_rank() e hamming_unrank(): per ogni classe si
+** verifica rank(unrank(i)) == i e che generate_k_subset_range(), fatta
+** partire da indici arbitrari, emetta in modalita' binaria gli stessi
+** sottoinsiemi di unrank(), sia attorno al riferimento canonico sia
+** attorno a uno sparso, alla distanza d da esso. Seguono le misure dei
+** tempi di rank e unrank per n = 1024 e della generazione attorno ai
+** due riferimenti.
+*/
+int main(void) {
+    static const size_t casi[][2] = {
+        {6, 3}, {10, 4}, {31, 4}, {32, 5}, {40, 3}, {64, 6}, {100, 4}, {200, 3}, {1024, 3}
+    };
+    uint64_t w[MW_WORDS];
+    size_t errori = 0, prove = 0;
+    const size_t reps = 1000000;
+    uint64_t chk = 0;
+    clock_t t0;
+    double t_rank, t_unrank;
+
+    out_init(true);
+    for (size_t c = 0; c < 2 * sizeof(casi) / sizeof(casi[0]); ++c) {
+        const size_t n = casi[c / 2][0], k = casi[c / 2][1];
+        const size_t len = (n <= 32) ? 4 : 8 * ((n + 63) / 64);
+        uint64_t rw[MW_WORDS] = {0};
+        // Riferimento canonico, poi sparso: {n/2k, n/2k + n/k, ...}
+        for (size_t i = 0; i < k; ++i) {
+            const size_t e = (c & 1) ? i * n / k + n / (2 * k) : i;
+            rw[e / 64] |= 1ULL << (e % 64);
+        }
+        set_reference(rw, n);
+        for (size_t d = 1; d <= k; ++d) {
+            const uint64_t tot = hamming_class_size(n, k, d);
+            const uint64_t passo = (tot > 20000) ? tot / 20000 + 1 : 1;
+            for (uint64_t i = 0; i < tot; i += passo) {
+                const uint64_t quanti = (tot - i < 64) ? tot - i : 64;
+                ++prove;
+                size_t dist = 0;
+                if (!hamming_unrank(i, n, k, d, w) || (hamming_rank(w, n, k, d) != i)) {
+                    ++errori;
+                    continue;
+                }
+                for (size_t j = 0; j < MW_WORDS; ++j) {
+                    dist += POPCNT64(w[j] & ~rw[j]);
+                }
+                errori += (dist != d);
+                // Confronto con il generatore ripartito da i
+                out_len = 0;
+                generate_k_subset_range(n, k, d, i, quanti);
+                for (uint64_t j = 0; j < quanti; ++j) {
+                    hamming_unrank(i + j, n, k, d, w);
+                    for (size_t b = 0; b < len; ++b) {
+                        if (out_buf[j * len + b] != (char)(w[b / 8] >> (8 * (b % 8)))) {
+                            ++errori;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (hamming_unrank(tot, n, k, d, w)) {
+                ++errori;
+            }
+        }
+    }
+    // Parametri fuori dalla tabella di Pascal: errore, nessun accesso
+    memset(w, 0, sizeof(w));
+    prove += 5;
+    errori += (0 != hamming_class_size(MAX_N + 2, 2, 1));
+    errori += (0 != hamming_class_size(40, 30, 1));
+    errori += (HAMMING_RANK_INVALID != hamming_rank(w, MAX_N + 2, 2, 1));
+    errori += hamming_unrank(0, 64, 4, 5, w);
+    errori += visit_k_subset_range(MAX_N + 2, 2, 1, 0, 1, NULL, NULL);
+    out_len = 0;
+    printf("Rank/unrank: %zu prove, %zu errori\n", prove, errori);
+
+    // Generazione attorno al riferimento canonico e a uno sparso
+    for (size_t c = 0; c < 2; ++c) {
+        const size_t n = 31, k = 6, d = 3, giri = 200;
+        const uint64_t tot = hamming_class_size(n, k, d);
+        uint64_t rw[MW_WORDS] = {0};
+        rw[0] = c ? 0x12488421ULL : 0x3FULL;
+        set_reference(rw, n);
+        t0 = clock();
+        for (size_t r = 0; r < giri; ++r) {
+            out_len = 0;
+            generate_k_subset_range(n, k, d, 0, tot);
+            chk += (uint8_t)out_buf[r];
+        }
+        printf("Riferimento %s (%08llX): %.2f ns per subset\n",
+               c ? "sparso..." : "canonico", (unsigned long long)rw[0],
+               (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / (giri * tot));
+    }
+    out_len = 0;
+    ref_canonica = true;
+
+    // Tempi per n = 1024, k = 12, d = 6
+    {
+        static uint64_t campioni[256][MW_WORDS];
+        const size_t n = 1024, k = 12, d = 6;
+        const uint64_t tot = hamming_class_size(n, k, d);
+        t0 = clock();
+        for (size_t r = 0; r < reps; ++r) {
+            hamming_unrank((r * 0x9E3779B97F4A7C15ULL) % tot, n, k, d, w);
+            chk += w[r % MW_WORDS];
+        }
+        t_unrank = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        for (size_t r = 0; r < 256; ++r) {
+            hamming_unrank((r * 0x9E3779B97F4A7C15ULL) % tot, n, k, d, campioni[r]);
+        }
+        t0 = clock();
+        for (size_t r = 0; r < reps; ++r) {
+            chk += hamming_rank(campioni[r & 255], n, k, d);
+        }
+        t_rank = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("n = %zu, k = %zu, d = %zu: classe di %llu elementi\n",
+               n, k, d, (unsigned long long)tot);
+        printf("unrank: %.1f ns, rank: %.1f ns (chk %llx)\n",
+               t_unrank * 1e9 / reps, t_rank * 1e9 / reps, (unsigned long long)chk);
+    }
+    return (0 == errori) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#elif defined(HAMMING_BALL_TEST)
+/*
+** Collaudo dei conteggi: per ogni larghezza la visita della palla di
+** raggio k, con un visitatore che conta per classe, deve coincidere
+** con i conteggi in forma chiusa, e il totale con C(n,k). Si verifica
+** l'interruzione anticipata e si confrontano i tempi della visita
+** senza stampa e della generazione con stampa su buffer.
+*/
+typedef struct {
+    uint64_t per_classe[MAX_N / 2 + 1];
+    uint64_t limite;            // Interruzione dopo limite visite
+    uint64_t visite;
+    uint64_t chk;
+} Conta_t;
+
+static bool visita_conta(const uint64_t* w, size_t nw, size_t d, void* ctx) {
+    Conta_t* c = (Conta_t *)ctx;
+    ++c->per_classe[d];
+    c->chk += w[nw - 1] ^ w[0];
+    return ++c->visite < c->limite;
+}
+
+int main(void) {
+    static const size_t casi[][2] = {
+        {8, 3}, {31, 4}, {32, 5}, {50, 4}, {64, 3}, {100, 3}, {128, 3}, {300, 3}, {1024, 2}
+    };
+    static Conta_t c;
+    size_t errori = 0;
+    char buf[400], buf2[400];
+    clock_t t0;
+    double t_visita, t_stampa;
+
+    for (size_t i = 0; i < sizeof(casi) / sizeof(casi[0]); ++i) {
+        const size_t n = casi[i][0], k = casi[i][1];
+        Big_t atteso, palla;
+        memset(&c, 0, sizeof(c));
+        c.limite = UINT64_MAX;
+        hamming_ball_visit(n, k, k, visita_conta, &c);
+        for (size_t d = 0; d <= k; ++d) {
+            hamming_class_count(n, k, d, &atteso);
+            errori += (atteso.len > 2) ||
+                      (c.per_classe[d] != ((uint64_t)atteso.l[1] << 32 | atteso.l[0]));
+        }
+        big_binom(n, k, &atteso);
+        hamming_ball_count(n, k, k, &palla);
+        errori += (0 != strcmp(big_str(&atteso, buf, sizeof(buf)),
+                               big_str(&palla, buf2, sizeof(buf2))));
+        printf("n = %4zu, k = %zu: %llu subset visitati, C(n,k) = %s\n", n, k,
+               (unsigned long long)c.visite, buf);
+
+        // Interruzione anticipata a meta' della visita
+        memset(&c, 0, sizeof(c));
+        c.limite = (uint64_t)strtoull(buf, NULL, 10) / 2;
+        errori += hamming_ball_visit(n, k, k, visita_conta, &c) || (c.visite != c.limite);
+    }
+
+    // Palla di raggio 3 per n = 31, k = 6: visita contro stampa
+    memset(&c, 0, sizeof(c));
+    c.limite = UINT64_MAX;
+    t0 = clock();
+    for (size_t r = 0; r < 20; ++r) {
+        hamming_ball_visit(31, 6, 3, visita_conta, &c);
+    }
+    t_visita = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    out_init(false);
+    t0 = clock();
+    for (size_t r = 0; r < 20; ++r) {
+        for (size_t d = 1; d <= 3; ++d) {
+            out_len = 0;
+            generate_k_subset_range(31, 6, d, 0, (OUT_BUF_SIZE - OUT_MAX_RIGA) / riga_max(31, 6));
+        }
+    }
+    t_stampa = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    out_len = 0;
+    printf("Palla di raggio 3, n = 31, k = 6: visita %.2f ns, stampa %.2f ns per subset\n",
+           t_visita * 1e9 / c.visite,
+           t_stampa * 1e9 / (20.0 * 3 * ((OUT_BUF_SIZE - OUT_MAX_RIGA) / riga_max(31, 6))));
+    printf("Conteggi: %zu errori\n", errori);
+    return (0 == errori) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#elif defined(HAMMING_PAR_BENCH)
+/*
+** Benchmark di scalabilita': n = 31, k = 6 in modalita' testo, per un
+** numero crescente di thread, nelle modalita' ordinata e libera.
+** L'output va ridiretto (> NUL oppure > /dev/null), i tempi e le
+** accelerazioni rispetto alla versione seriale sono scritti su stderr.
+*/
+static double orologio(void) {
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+int main(void) {
+    const size_t n = 31, k = 6;
+    size_t max_t = 1;
+    double t0, t_ser;
+
+    out_init(false);
+#ifdef _OPENMP
+    max_t = (size_t)omp_get_max_threads();
+#endif
+
+    par_modo = PAR_SERIALE;
+    t0 = orologio();
+    generate_all_subsets(n, k);
+    out_flush();
+    t_ser = orologio() - t0;
+    fprintf(stderr, "n = %zu, k = %zu: %llu subset, seriale %.3f s\n",
+            n, k, (unsigned long long)counter + 1, t_ser);
+    fprintf(stderr, "thread   ordinato (acc.)    libero (acc.)\n");
+
+    // Potenze di due, piu' il massimo numero di thread disponibili
+    for (size_t t = 1; ; t = (2 * t < max_t) ? 2 * t : max_t) {
+        double t_ord, t_lib;
+#ifdef _OPENMP
+        omp_set_num_threads((int)t);
+#endif
+        par_modo = PAR_ORDINATO;
+        t0 = orologio();
+        generate_all_subsets(n, k);
+        out_flush();
+        t_ord = orologio() - t0;
+
+        par_modo = PAR_LIBERO;
+        t0 = orologio();
+        generate_all_subsets(n, k);
+        out_flush();
+        t_lib = orologio() - t0;
+
+        fprintf(stderr, "%6zu %8.3f s (%4.2fx) %8.3f s (%4.2fx)\n", t,
+                t_ord, t_ser / t_ord, t_lib, t_ser / t_lib);
+        if (t == max_t) {
+            break;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+#elif !defined(HAMMING_LIB)
 int main(int argc, char *argv[]) {
     size_t n, k, d;
+    char riga[160];
+    bool binario = false, conta = false;
+    const char* rif = NULL;
+    const char* hdb = NULL;
+    uint64_t rif_mask = 0;
+    int a = 1;
+
+    // Opzioni: -b binario, -f file .hdb, -p parallelo ordinato,
+    // -P parallelo libero, -r riferimento, -c solo conteggi
+    for (; (a < argc) && ('-' == argv[a][0]); ++a) {
+        if ((0 == strcmp(argv[a], "-r")) && (a + 1 < argc)) {
+            rif = argv[++a];
+        } else if ((0 == strcmp(argv[a], "-f")) && (a + 1 < argc)) {
+            hdb = argv[++a];
+        } else if (0 == strcmp(argv[a], "-c")) {
+            conta = true;
+        } else if (0 == strcmp(argv[a], "-b")) {
+            binario = true;
+        } else if (0 == strcmp(argv[a], "-p")) {
+            par_modo = PAR_ORDINATO;
+        } else if (0 == strcmp(argv[a], "-P")) {
+            par_modo = PAR_LIBERO;
+        } else {
+            break;
+        }
+    }
     
     // Verifica degli argomenti da riga di comando
-    if (argc != 3) {
-        fprintf(stderr, "** Uso: %s n k\n"
-                "** k > 2 e 2k <= n <= %d.\n", 
+    if (argc != a + 2) {
+        fprintf(stderr, "** Uso: %s [-b|-f file.hdb] [-p|-P] [-r i,j,...] [-c] n k\n"
+                "** k > 2 e 2k <= n <= %d.\n"
+                "** -b: maschere binarie little-endian, senza testo.\n"
+                "** -f: formato .hdb (HammingDB.h) su file, per n <= 64.\n"
+                "** -p: generazione parallela, stesso ordine della seriale.\n"
+                "** -P: generazione parallela, ordine dei blocchi libero.\n"
+                "** -r: k elementi del riferimento, da 0 a n-1 (difetto 0..k-1).\n"
+                "** -c: solo conteggi per classe e per palla, senza enumerare.\n", 
                 argv[0], MAX_N);
         return EXIT_FAILURE;
     } 
         
-    n = (size_t)atoi(argv[1]);
-    k = (size_t)atoi(argv[2]);
+    n = (size_t)atoi(argv[a]);
+    k = (size_t)atoi(argv[a + 1]);
     
     srand((unsigned int)time(NULL));
     
@@ -268,19 +1666,115 @@ int main(int argc, char *argv[]) {
         fprintf(stderr, "Errore: Assicurati che 2 < k e 2k <= n <= %d.\n", MAX_N);
         return EXIT_FAILURE;
     }
+
+    // Sottoinsieme di riferimento, come lista di indici
+    if (NULL != rif) {
+        uint64_t w[MW_WORDS] = {0};
+        size_t quanti = 0;
+        char* p = (char *)rif;
+        while ('\0' != *p) {
+            const unsigned long i = strtoul(p, &p, 10);
+            if ((i >= n) || ((w[i / 64] >> (i % 64)) & 1)) {
+                quanti = 0;
+                break;
+            }
+            w[i / 64] |= 1ULL << (i % 64);
+            ++quanti;
+            if (',' == *p) {
+                ++p;
+            } else if ('\0' != *p) {
+                quanti = 0;
+                break;
+            }
+        }
+        if ((quanti != k) || !set_reference(w, n)) {
+            fprintf(stderr, "Errore: il riferimento deve avere %zu elementi "
+                    "distinti tra 0 e %zu.\n", k, n - 1);
+            return EXIT_FAILURE;
+        }
+        rif_mask = w[0];
+    }
     
+    // Solo conteggi, in forma chiusa e a precisione multipla
+    if (conta) {
+        char classe[400], palla[400];
+        Big_t c, b;
+        printf("** Conteggi dei %zu-subset di un %zu-insieme per distanza:\n", k, n);
+        for (d = 0; d <= k; ++d) {
+            hamming_class_count(n, k, d, &c);
+            hamming_ball_count(n, k, d, &b);
+            printf("d = %3zu: %s (palla di raggio %zu: %s)\n", d,
+                   big_str(&c, classe, sizeof(classe)), d,
+                   big_str(&b, palla, sizeof(palla)));
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // Formato .hdb: intestazione con l'inizio di ogni classe, in forma
+    // chiusa, seguita dalle stesse maschere della modalita' binaria
+    if (NULL != hdb) {
+        uint8_t header[HDB_MAX_HEADER];
+        uint64_t offset[HDB_MAX_K + 2] = {0};
+        size_t dim;
+        bool ok;
+
+        if (n > HDB_MAX_N) {
+            fprintf(stderr, "Errore: il formato .hdb richiede n <= %d.\n", HDB_MAX_N);
+            return EXIT_FAILURE;
+        }
+        out_file = fopen(hdb, "wb");
+        if (NULL == out_file) {
+            fprintf(stderr, "Errore: impossibile creare %s.\n", hdb);
+            return EXIT_FAILURE;
+        }
+        for (d = 0; d <= k; ++d) {
+            offset[d + 1] = offset[d] + hamming_class_size(n, k, d);
+        }
+        dim = hdb_header(header, n, k, (NULL != rif) ? rif_mask : (1ULL << k) - 1, offset);
+        fwrite(header, 1, dim, out_file);
+        out_init(true);
+        generate_all_subsets(n, k);
+        out_flush();
+        ok = (0 == ferror(out_file));
+        ok = (0 == fclose(out_file)) && ok;
+        if (!ok) {
+            fprintf(stderr, "Errore di scrittura su %s.\n", hdb);
+            return EXIT_FAILURE;
+        }
+        fprintf(stderr, "** Subset scritti in %s: %llu\n", hdb,
+                (unsigned long long)offset[k + 1]);
+        return EXIT_SUCCESS;
+    }
+
+    out_init(binario);
+
+    // In modalita' binaria solo le maschere della FASE 2, in ordine
+    if (binario) {
+        generate_all_subsets(n, k);
+        out_flush();
+        fprintf(stderr, "** Subset generati: %llu\n", (unsigned long long)counter + 1);
+        return EXIT_SUCCESS;
+    }
+
     // FASE 1: Generazione con distanza casuale
     d = (rand() % k) + 1;
-    printf("** FASE 1: Generazione dei %zu-subset a distanza casuale (%zu)\n", k, d);
+    snprintf(riga, sizeof(riga),
+             "** FASE 1: Generazione dei %zu-subset a distanza casuale (%zu)\n", k, d);
+    out_str(riga);
     generate_k_subset(n, k, 0);   // Prima il subset base
     generate_k_subset(n, k, d);   // Poi i subset a distanza d
 
     // FASE 2: Generazione completa per ogni distanza
-    printf("\n** FASE 2: Generazione esaustiva dei %zu-subset\n"
-           "**         ordinati per distanza di Hamming crescente:\n", k);
+    snprintf(riga, sizeof(riga), "\n** FASE 2: Generazione esaustiva dei %zu-subset\n"
+             "**         ordinati per distanza di Hamming crescente:\n", k);
+    out_str(riga);
     generate_all_subsets(n, k);
-    printf("\n** Subset generati: %zu\n\n", counter);
+    snprintf(riga, sizeof(riga), "\n** Subset generati: %llu\n\n",
+             (unsigned long long)counter);
+    out_str(riga);
+    out_flush();
 
     return EXIT_SUCCESS;
 }
+#endif
 /** EOF: Hamming_DL.c **/
\ No newline at end of file
@@ -6,19 +6,19 @@
 /**********************************************************************/
 /* CODE METRICS:                                                      */
 /* Size metrics:                                                      */
-/*   - Lines of Code (LOC): 221                                       */
-/*   - Logical Lines of Code (LLOC): 169                              */
-/*   - Comment Lines: 52                                              */
-/*   - Comment-to-Code Ratio: 0.31                                    */
+/*   - Lines of Code (LOC): 1009                                      */
+/*   - Logical Lines of Code (LLOC): 436                              */
+/*   - Comment Lines: 282                                             */
+/*   - Comment-to-Code Ratio: 0.42                                    */
 /* Complexity metrics:                                                */
-/*   - Cyclomatic Complexity: 34                                      */
-/*   - McCabe's Essential Complexity: 28                              */
-/*   - Maximum Nesting Level: 2                                       */
-/*   - Maintainability Index: 61 (Moderate)                           */
+/*   - Cyclomatic Complexity: 149                                     */
+/*   - McCabe's Essential Complexity: 68                              */
+/*   - Maximum Nesting Level: 3                                       */
+/*   - Maintainability Index: 76 (Good)                               */
 /* Halstead metrics:                                                  */
-/*   - Program Volume (V): 4,421                                      */
-/*   - Program Difficulty (D): 41.3                                   */
-/*   - Development Time Estimate: 10.14 hours                         */
+/*   - Program Volume (V): 28,201                                     */
+/*   - Program Difficulty (D): 246.0                                  */
+/*   - Development Time Estimate: 385.39 hours                        */
 /**********************************************************************/
 /* TECHGLISH: This file implements three different algorithms from    */
 /* Donald Knuth's "The Art of Computer Programming" for generating    */
@@ -37,8 +37,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "HammingBits.h"
+#include "Generators.h"
 
-#define ENABLE_OUTPUT
 /* Limite arbitrario, anche per evitare attese con tempi geologici */
 #define MAX_K 16
 
@@ -46,48 +51,74 @@
 /* TECHGLISH: We represent k-subsets as arrays of integers.      */
 /* Array S stores the elements of the current subset, with       */
 /* additional positions for sentinel values that simplify the    */
-/* algorithms' logic and boundary handling.                      */
+/* algorithms' logic and boundary handling. Each generator owns  */
+/* its array, so the generators are reentrant and usable as a    */
+/* library: the current subset is handed to a visitor, which     */
+/* returns false to stop the generation early.                   */
 /*                                                               */
 /* NERDYTALIAN: Rappresentiamo i k-sottoinsiemi come array di    */
 /* interi. L'array S memorizza gli elementi del sottoinsieme     */
 /* corrente, con posizioni aggiuntive per valori sentinella che  */
 /* semplificano la logica degli algoritmi e la gestione dei      */
-/* confini.                                                      */
+/* confini. Ogni generatore possiede il proprio array, quindi i  */
+/* generatori sono rientranti e utilizzabili come libreria: il   */
+/* sottoinsieme corrente viene passato a un visitatore, che      */
+/* restituisce false per interrompere anticipatamente.           */
 /*****************************************************************/
 
-/* Puntatore al sottoinsieme generato */
-int *S;
+/* Visitor_t, MaskVisitor_t e DeltaVisitor_t: vedi Generators.h */
 
 /* Totalizzatore k-sottoinsiemi generati - binomiale(n,k) */
 size_t TotalSet;
 
 /******************* OUTPUT FUNCTION ****************************/
 /* TECHGLISH: Displays the current subset in a human-readable   */
-/* format. The ENABLE_OUTPUT macro allows turning off output    */
-/* when pure performance benchmarking is needed, while still    */
-/* maintaining accurate counting of generated subsets.          */
+/* format. It is just one visitor among others: benchmarks pass */
+/* a counting or checksum visitor instead, with no rebuild.     */
 /*                                                              */
 /* NERDYTALIAN: Visualizza il sottoinsieme corrente in un       */
-/* formato leggibile. La macro ENABLE_OUTPUT consente di        */
-/* disattivare l'output quando e' necessario un benchmarking     */
-/* puro delle prestazioni, mantenendo comunque un conteggio     */
-/* accurato dei sottoinsiemi generati.                          */
+/* formato leggibile. E' solo uno dei possibili visitatori: i   */
+/* benchmark passano invece un visitatore di conteggio o di     */
+/* checksum, senza ricompilare.                                 */
 /****************************************************************/
 
-void printSubset(size_t k)
+bool printSubset(const int* S, size_t k, void* ctx)
 {
-#ifdef ENABLE_OUTPUT
-    static size_t cnt = 0;
+    (void)ctx;
     printf("%5zu {%d, ", TotalSet++, S[0]);
     for (size_t i = 1; i < k -1; ++i) {
         printf("%d, ", S[i]);
     }
     printf("%d}\n", S[k -1]);
-#else
-    TotalSet++;
-#endif
+    return true;
 }
 
+/******************* VISITOR TEMPLATES **************************/
+/* TECHGLISH: The C counterpart of a C++ template with a functor */
+/* parameter. Each DEFINE_ macro instantiates a generator whose  */
+/* visit step is the VISIT(S, k, f, ctx) expression, expanded    */
+/* right inside the goto state machine: with a static inline     */
+/* visitor the compiler inlines it, exactly as hand-written code.*/
+/* VISIT_FP calls the function pointer f instead, and gives the  */
+/* public C API. Every generator returns false when the visitor  */
+/* stopped it, true when all the subsets have been visited.      */
+/*                                                               */
+/* NERDYTALIAN: L'equivalente C di un template C++ con un funtore*/
+/* come parametro. Ogni macro DEFINE_ istanzia un generatore il  */
+/* cui passo di visita e' l'espressione VISIT(S, k, f, ctx),     */
+/* espansa direttamente nella macchina a stati con goto: con un  */
+/* visitatore static inline il compilatore lo integra, proprio   */
+/* come il codice scritto a mano. VISIT_FP chiama invece il      */
+/* puntatore a funzione f, e costituisce l'API C pubblica. Ogni  */
+/* generatore restituisce false se il visitatore l'ha fermato,   */
+/* true se ha visitato tutti i sottoinsiemi.                     */
+/****************************************************************/
+
+#define VISIT_FP(S, k, f, ctx) (f)((S), (k), (ctx))
+#define VISIT_MASK_FP(B, f, ctx) (f)((B), (ctx))
+/* Il primo sottoinsieme, {0, ..., k-1}, e' implicito nel flusso */
+#define VISIT_DELTA_FP(S, k, f, ctx) ((uscito < 0) || (f)(uscito, entrato, (ctx)))
+
 /******************* ALGORITHM T: LEXICOGRAPHIC ******************/
 /* TECHGLISH: Generates k-subsets in lexicographic order, as     */
 /* described in TAOCP 7.2.1.3, Algorithm T. This algorithm       */
@@ -100,61 +131,84 @@ void printSubset(size_t k)
 /* valori sentinella S[k] e S[k+1] per la gestione dei confini.  */
 /*****************************************************************/
 
-void T_ksubsetLex(const size_t k, const size_t n) {
-    int j, x;
-
-init:
-    // Initialize S[0...k-1] with the first k integers
-    for (j = 0; j < k; j++) {
-        S[j] = j;
-    }
-
-    // Set up sentinel values
-    j = k;
-    S[k] = n;      // Upper bound for comparisons
-    S[k+1] = 0;    // Ensures termination
-
-visit:
-    // Output the current subset
-    printSubset(k);
-
-    // Determine the next step based on the current state
-    if (j > 0) {
-        x = j;
-        goto increment;
-    }
-
-    // Easy case: increment S[0] if possible
-    if (S[0] + 1 < S[1]) {
-        S[0]++;
-        goto visit;
-    }
-    else {
-        j = 2;
-    }
-
-find_j:
-    // Reset elements before j-1 to their minimal values
-    S[j - 2] = j - 2;
-    x = S[j-1] + 1;
-
-    // If we can't increment S[j-1], move to the next position
-    if (x == S[j]) {
-        j++;
-        goto find_j;
-    }
-
-done:
-    // Check if we've generated all subsets
-    if (j > k) {
-        return;
+/* S[] ha MAX_K + 2 posti: k oltre MAX_K scriverebbe fuori dallo stack */
+static bool ksubsetParametri(const char* nome, size_t k, size_t n) {
+    if ((0 == k) || (k > MAX_K) || (k > n) || (n > INT_MAX)) {
+        fprintf(stderr, "%s: parametri non validi (k = %zu, n = %zu).\n", nome, k, n);
+        return false;
     }
+    return true;
+}
 
-increment:
-    // Increment S[j-1] and reset j for the next iteration
-    S[j-1] = x;
-    j--;
-    goto visit;
+#define DEFINE_T_KSUBSETLEX(NAME, VISIT)                                 \
+bool NAME(const size_t k, const size_t n, Visitor_t f, void* ctx) {      \
+    int S[MAX_K + 2];                                                    \
+    const int K = (int)k;                                                \
+    int j, x;                                                            \
+    (void)f;                                                             \
+    (void)ctx;                                                           \
+                                                                         \
+    if (!ksubsetParametri(#NAME, k, n)) {                                \
+        return false;                                                    \
+    }                                                                    \
+                                                                         \
+    /* init: Initialize S[0...k-1] with the first k integers */          \
+    for (j = 0; j < K; j++) {                                            \
+        S[j] = j;                                                        \
+    }                                                                    \
+                                                                         \
+    /* Set up sentinel values */                                         \
+    j = K;                                                               \
+    S[K] = (int)n;  /* Upper bound for comparisons */                    \
+    S[K+1] = 0;     /* Ensures termination */                            \
+                                                                         \
+    /* k = n: un solo sottoinsieme, Knuth assume k < n */                \
+    if (K == (int)n) {                                                   \
+        return VISIT(S, k, f, ctx) ? true : false;                       \
+    }                                                                    \
+                                                                         \
+visit:                                                                   \
+    /* Visit the current subset */                                       \
+    if (!VISIT(S, k, f, ctx)) {                                          \
+        return false;                                                    \
+    }                                                                    \
+                                                                         \
+    /* Determine the next step based on the current state */             \
+    if (j > 0) {                                                         \
+        x = j;                                                           \
+        goto increment;                                                  \
+    }                                                                    \
+                                                                         \
+    /* Easy case: increment S[0] if possible */                          \
+    if (S[0] + 1 < S[1]) {                                               \
+        S[0]++;                                                          \
+        goto visit;                                                      \
+    }                                                                    \
+    else {                                                               \
+        j = 2;                                                           \
+    }                                                                    \
+                                                                         \
+find_j:                                                                  \
+    /* Reset elements before j-1 to their minimal values */              \
+    S[j - 2] = j - 2;                                                    \
+    x = S[j-1] + 1;                                                      \
+                                                                         \
+    /* If we can't increment S[j-1], move to the next position */        \
+    if (x == S[j]) {                                                     \
+        j++;                                                             \
+        goto find_j;                                                     \
+    }                                                                    \
+                                                                         \
+    /* done: Check if we've generated all subsets */                     \
+    if (j > K) {                                                         \
+        return true;                                                     \
+    }                                                                    \
+                                                                         \
+increment:                                                               \
+    /* Increment S[j-1] and reset j for the next iteration */            \
+    S[j-1] = x;                                                          \
+    j--;                                                                 \
+    goto visit;                                                          \
 }
 
 /******************* ALGORITHM R: GRAY CODE ********************/
@@ -169,110 +223,652 @@ increment:
 /* sottoinsiemi consecutivi differiscono per esattamente un     */
 /* elemento - un codice Gray per le combinazioni. La direzione  */
 /* di cambiamento si alterna in base alla parita' di k.          */
+/*                                                              */
+/* TECHGLISH: Each step swaps one element, and the state        */
+/* machine knows which one: before the visit it stores the pair */
+/* (uscito, entrato) = (element out, element in), -1 for the    */
+/* first subset. A VISIT expression may read those two locals,  */
+/* and the instantiation with a DeltaVisitor_t turns Algorithm  */
+/* R into a stream of O(1) deltas instead of whole subsets.     */
+/*                                                              */
+/* NERDYTALIAN: Ogni passo scambia un elemento, e la macchina a */
+/* stati sa quale: prima della visita memorizza la coppia       */
+/* (uscito, entrato), -1 per il primo sottoinsieme.             */
+/* L'espressione VISIT puo' leggere le due variabili locali,    */
+/* e l'istanza con un DeltaVisitor_t trasforma l'Algoritmo R    */
+/* in un flusso di variazioni O(1) anziche' di sottoinsiemi     */
+/* interi.                                                      */
 /****************************************************************/
 
-void R_ksubsetRD(const size_t k, const size_t n) {
-    int j;
+#define DEFINE_R_KSUBSETRD_T(NAME, VISITOR_T, VISIT)                     \
+bool NAME(const size_t k, const size_t n, VISITOR_T f, void* ctx) {      \
+    int S[MAX_K + 2];                                                    \
+    const int K = (int)k;                                                \
+    int j;                                                               \
+    int uscito = -1, entrato = -1;                                       \
+    (void)uscito;                                                        \
+    (void)entrato;                                                       \
+    (void)f;                                                             \
+    (void)ctx;                                                           \
+                                                                         \
+    if (!ksubsetParametri(#NAME, k, n)) {                                \
+        return false;                                                    \
+    }                                                                    \
+                                                                         \
+    /* init: Initialize with the first subset: {0, 1, ..., k-1} */       \
+    for (j = 0; j < K; j++) {                                            \
+        S[j] = j;                                                        \
+    }                                                                    \
+                                                                         \
+    S[K] = (int)n;  /* Sentinel value */                                 \
+    S[K+1] = 0;     /* Ensures termination */                            \
+                                                                         \
+    /* k = n: un solo sottoinsieme, Knuth assume k < n */                \
+    if (K == (int)n) {                                                   \
+        return VISIT(S, k, f, ctx) ? true : false;                       \
+    }                                                                    \
+                                                                         \
+visit:                                                                   \
+    /* Visit the current subset */                                       \
+    if (!VISIT(S, k, f, ctx)) {                                          \
+        return false;                                                    \
+    }                                                                    \
+                                                                         \
+    /* easy: Determine direction based on parity of k */                 \
+    if (K & 1) {                                                         \
+        /* Odd k: try to increase S[0] */                                \
+        if (S[0] + 1 < S[1]) {                                           \
+            uscito = S[0];                                               \
+            entrato = S[0] + 1;                                          \
+            S[0]++;                                                      \
+            goto visit;                                                  \
+        }                                                                \
+        else {                                                           \
+            /* k = 1: S[0] ha percorso 0..n-1, non c'e' S[j-2] */        \
+            if (1 == K) {                                                \
+                return true;                                             \
+            }                                                            \
+            j = 2;                                                       \
+            goto decrease;                                               \
+        }                                                                \
+    }                                                                    \
+    else {                                                               \
+        /* Even k: try to decrease S[0] */                               \
+        if (S[0] > 0) {                                                  \
+            uscito = S[0];                                               \
+            entrato = S[0] - 1;                                          \
+            S[0]--;                                                      \
+            goto visit;                                                  \
+        }                                                                \
+        else {                                                           \
+            j = 2;                                                       \
+            goto increase;                                               \
+        }                                                                \
+    }                                                                    \
+                                                                         \
+decrease:                                                                \
+    /* Try to decrease S[j-1] */                                         \
+    if (S[j-1] >= j) {                                                   \
+        uscito = S[j-1];                                                 \
+        entrato = j - 2;                                                 \
+        S[j-1] = S[j-2];                                                 \
+        S[j-2] = j - 2;                                                  \
+        goto visit;                                                      \
+    }                                                                    \
+    else {                                                               \
+        j++;                                                             \
+    }                                                                    \
+                                                                         \
+increase:                                                                \
+    /* Try to increase S[j-1] */                                         \
+    if (S[j-1] + 1 < S[j]) {                                             \
+        uscito = S[j-2];                                                 \
+        entrato = S[j-1] + 1;                                            \
+        S[j-2] = S[j-1];                                                 \
+        S[j-1]++;                                                        \
+        goto visit;                                                      \
+    }                                                                    \
+    else {                                                               \
+        j++;                                                             \
+        if (j <= K) goto decrease;                                       \
+    }                                                                    \
+    return true;                                                         \
+}
 
-init:
-    // Initialize with the first subset: {0, 1, ..., k-1}
-    for (j = 0; j < k; j++) {
-        S[j] = j;
+#define DEFINE_R_KSUBSETRD(NAME, VISIT) DEFINE_R_KSUBSETRD_T(NAME, Visitor_t, VISIT)
+
+/******************* GOSPER'S ALGORITHM ************************/
+/* TECHGLISH: Implements Gosper's algorithm for generating all  */
+/* k-subsets using bitwise operations. This algorithm           */
+/* represents subsets as bit vectors and uses an elegant bit    */
+/* manipulation formula to generate the next combination,       */
+/* providing excellent performance for small universe sizes.    */
+/*                                                              */
+/* NERDYTALIAN: Implementa l'algoritmo di Gosper per generare   */
+/* tutti i k-sottoinsiemi utilizzando operazioni bit a bit.     */
+/* Questo algoritmo rappresenta i sottoinsiemi come vettori di  */
+/* bit e utilizza una formula elegante di manipolazione dei bit */
+/* per generare la combinazione successiva, offrendo eccellenti */
+/* prestazioni per universi di piccole dimensioni.              */
+/*                                                              */
+/* TECHGLISH: The rightmost 1-bit u is a power of two, so the   */
+/* classic division (v ^ x) / u is a right shift by ctz(x), and */
+/* the indices are extracted in O(k) by repeatedly taking the   */
+/* ctz and clearing the lowest set bit (blsr), instead of       */
+/* testing all the n positions. The mask variant hands the bit  */
+/* vector itself to the visitor, with no extraction at all.     */
+/*                                                              */
+/* NERDYTALIAN: Il bit a 1 meno significativo u e' una potenza  */
+/* di due, quindi la classica divisione (v ^ x) / u e' uno      */
+/* shift a destra di ctz(x) posizioni, e gli indici si          */
+/* estraggono in O(k) prendendo ripetutamente il ctz e          */
+/* azzerando il bit a 1 meno significativo (blsr), invece di    */
+/* esaminare tutte le n posizioni. La variante per maschere     */
+/* passa al visitatore il bit vector stesso, senza estrazione.  */
+/****************************************************************/
+
+/* Successore di Gosper senza divisione, x != 0 */
+static inline uint64_t gosperNext(uint64_t x) {
+    uint64_t u = x & (~x + 1);      /* Isolate rightmost 1-bit */
+    uint64_t v = x + u;             /* Propagate carry */
+    /* Add displaced bits: (v ^ x) / u == (v ^ x) >> ctz(x) */
+    return v + (((v ^ x) >> CTZ64(x)) >> 2);
+}
+
+/*
+** Parametri ammessi da Gosper: 1 <= k <= n <= 64. Il primo k-subset e'
+** 00...0011...11 (k uni), l'ultimo 11...1100...00: il ciclo termina su
+** quest'ultimo, senza calcolare 1 << n ne' il successore che trabocca.
+*/
+static bool gosperParametri(size_t k, size_t n, size_t max_k,
+                            uint64_t* primo, uint64_t* ultimo) {
+    if ((0 == k) || (k > n) || (n > 64) || (k > max_k)) {
+        fprintf(stderr, "Gosper: parametri non validi (k = %zu, n = %zu).\n", k, n);
+        return false;
     }
+    *primo = ~0ULL >> (64 - k);
+    *ultimo = *primo << (n - k);
+    return true;
+}
 
-    S[k] = n;  // Sentinel value
+#define DEFINE_G_KSUBSETGOSPER(NAME, VISIT)                              \
+bool NAME(const size_t k, const size_t n, Visitor_t f, void* ctx) {      \
+    int S[MAX_K + 2];                                                    \
+    uint64_t x, last;                                                    \
+    (void)f;                                                             \
+    (void)ctx;                                                           \
+                                                                         \
+    if (!gosperParametri(k, n, MAX_K, &x, &last)) {                      \
+        return false;                                                    \
+    }                                                                    \
+    for (;;) {                                                           \
+        /* Convert bit representation to integer array: ctz + blsr */    \
+        size_t j = 0;                                                    \
+        for (uint64_t y = x; 0 != y; y &= y - 1) {                       \
+            S[j++] = (int)CTZ64(y);                                      \
+        }                                                                \
+        if (!VISIT(S, k, f, ctx)) {                                      \
+            return false;                                                \
+        }                                                                \
+        if (x == last) {                                                 \
+            return true;                                                 \
+        }                                                                \
+        x = gosperNext(x);                                               \
+    }                                                                    \
+}
 
-visit:
-    // Output the current subset
-    printSubset(k);
-
-easy:
-    // Determine direction based on parity of k
-    if (k & 1) {
-        // Odd k: try to increase S[0]
-        if (S[0] + 1 < S[1]) {
-            S[0]++;
-            goto visit;
+#define DEFINE_G_KSUBSETGOSPERMASK(NAME, VISIT)                          \
+bool NAME(const size_t k, const size_t n, MaskVisitor_t f, void* ctx) {  \
+    uint64_t x, last;                                                    \
+    (void)f;                                                             \
+    (void)ctx;                                                           \
+                                                                         \
+    if (!gosperParametri(k, n, 64, &x, &last)) {                         \
+        return false;                                                    \
+    }                                                                    \
+    for (;;) {                                                           \
+        if (!VISIT(x, f, ctx)) {                                         \
+            return false;                                                \
+        }                                                                \
+        if (x == last) {                                                 \
+            return true;                                                 \
+        }                                                                \
+        x = gosperNext(x);                                               \
+    }                                                                    \
+}
+
+/* API C pubblica: visitatore tramite puntatore a funzione */
+DEFINE_T_KSUBSETLEX(T_ksubsetLex, VISIT_FP)
+DEFINE_R_KSUBSETRD(R_ksubsetRD, VISIT_FP)
+DEFINE_G_KSUBSETGOSPER(G_ksubsetGosper, VISIT_FP)
+DEFINE_G_KSUBSETGOSPERMASK(G_ksubsetGosperMask, VISIT_MASK_FP)
+DEFINE_R_KSUBSETRD_T(R_ksubsetRDDelta, DeltaVisitor_t, VISIT_DELTA_FP)
+
+/******************* DELTA STREAM ******************************/
+/* TECHGLISH: Algorithm R written as a stream of variations: a  */
+/* header with k and n, then one (out, in) pair per step. The   */
+/* binary format takes 2 bytes per step (n <= 256), the text    */
+/* one a line "out in"; both replace the k elements printed by  */
+/* printSubset, so the volume drops by a factor of about k.     */
+/* The decoder starts from {0, ..., k-1} and applies each pair  */
+/* in O(1): pos[] locates the outgoing element, and in revdoor  */
+/* order the incoming one lands in the same or an adjacent      */
+/* position of the sorted array, so the shift is at most one.   */
+/*                                                              */
+/*   binary: 'R' 'D' k n_lo n_hi, then out in out in ...        */
+/*   text:   "RD k n", then one line "out in" per step          */
+/*                                                              */
+/* NERDYTALIAN: L'Algoritmo R scritto come flusso di variazioni:*/
+/* un'intestazione con k e n, poi una coppia (uscito, entrato)  */
+/* per passo. Il formato binario occupa 2 byte per passo        */
+/* (n <= 256), quello testuale una riga "uscito entrato";       */
+/* entrambi sostituiscono i k elementi stampati da printSubset, */
+/* riducendo il volume di un fattore pari a circa k. Il         */
+/* decodificatore parte da {0, ..., k-1} e applica ogni coppia  */
+/* in O(1): pos[] individua l'elemento uscito, e nell'ordine    */
+/* revdoor l'entrato occupa la stessa posizione dell'array      */
+/* ordinato o una adiacente, quindi lo scorrimento e' al piu'   */
+/* di un passo.                                                 */
+/****************************************************************/
+
+/* Elementi rappresentabili in un byte */
+#define DELTA_MAX_N 256
+
+bool deltaScriviHeader(FILE* out, size_t k, size_t n, bool binario)
+{
+    if (binario) {
+        const unsigned char h[5] = {'R', 'D', (unsigned char)k,
+                                    (unsigned char)(n & 0xFF), (unsigned char)(n >> 8)};
+        return sizeof(h) == fwrite(h, 1, sizeof(h), out);
+    }
+    return fprintf(out, "RD %zu %zu\n", k, n) > 0;
+}
+
+bool deltaTesto(int uscito, int entrato, void* ctx)
+{
+    return fprintf((FILE*)ctx, "%d %d\n", uscito, entrato) > 0;
+}
+
+bool deltaBinario(int uscito, int entrato, void* ctx)
+{
+    FILE* out = (FILE*)ctx;
+    return (EOF != putc(uscito, out)) && (EOF != putc(entrato, out));
+}
+
+/*
+** Legge l'intestazione e riconosce il formato: in quello binario il
+** terzo byte e' k <= MAX_K, quindi mai uno spazio.
+*/
+bool deltaLeggiHeader(FILE* in, size_t* k, size_t* n, bool* binario)
+{
+    int c;
+
+    if (('R' != getc(in)) || ('D' != getc(in))) {
+        return false;
+    }
+    c = getc(in);
+    *binario = (' ' != c);
+    if (*binario) {
+        int lo = getc(in);
+        int hi = getc(in);
+        if ((EOF == c) || (EOF == lo) || (EOF == hi)) {
+            return false;
+        }
+        *k = (size_t)c;
+        *n = (size_t)lo | ((size_t)hi << 8);
+    }
+    else if (2 != fscanf(in, "%zu %zu", k, n)) {
+        return false;
+    }
+    return (*k > 0) && (*k <= MAX_K) && (*k < *n) && (!*binario || (*n <= DELTA_MAX_N));
+}
+
+/*
+** Ricostruisce i sottoinsiemi dal flusso e li passa, ordinati come in
+** R_ksubsetRD, al visitatore. Restituisce false se il flusso non e'
+** valido o se il visitatore ha interrotto la decodifica.
+*/
+bool deltaDecodifica(FILE* in, size_t k, size_t n, bool binario, Visitor_t f, void* ctx)
+{
+    int S[MAX_K];
+    int* pos;                   /* Posizione in S, -1 se assente */
+    int uscito, entrato;
+    size_t p;
+    bool ok = true;
+
+    pos = (int*)malloc(n * sizeof(int));
+    if (NULL == pos) {
+        return false;
+    }
+    for (p = 0; p < n; ++p) {
+        pos[p] = -1;
+    }
+    for (p = 0; p < k; ++p) {
+        S[p] = (int)p;
+        pos[p] = (int)p;
+    }
+
+    ok = f(S, k, ctx);
+    while (ok) {
+        if (binario) {
+            uscito = getc(in);
+            if (EOF == uscito) {
+                break;
+            }
+            entrato = getc(in);
         }
         else {
-            j = 2;
-            goto decrease;
+            int letti = fscanf(in, "%d %d", &uscito, &entrato);
+            if (EOF == letti) {
+                break;
+            }
+            entrato = (2 == letti) ? entrato : EOF;
         }
-    }
-    else {
-        // Even k: try to decrease S[0]
-        if (S[0] > 0) {
-            S[0]--;
-            goto visit;
+
+        /* Esce un elemento presente, entra uno assente */
+        if ((uscito < 0) || (entrato < 0) || ((size_t)uscito >= n) || ((size_t)entrato >= n)
+            || (pos[uscito] < 0) || (pos[entrato] >= 0)) {
+            ok = false;
+            break;
+        }
+        p = (size_t)pos[uscito];
+        pos[uscito] = -1;
+        if (entrato > uscito) {
+            while ((p + 1 < k) && (S[p + 1] < entrato)) {
+                S[p] = S[p + 1];
+                pos[S[p]] = (int)p;
+                ++p;
+            }
         }
         else {
-            j = 2;
-            goto increase;
+            while ((p > 0) && (S[p - 1] > entrato)) {
+                S[p] = S[p - 1];
+                pos[S[p]] = (int)p;
+                --p;
+            }
         }
+        S[p] = entrato;
+        pos[entrato] = (int)p;
+        ok = f(S, k, ctx);
     }
 
-decrease:
-    // Try to decrease S[j-1]
-    if (S[j-1] >= j) {
-        S[j-1] = S[j-2];
-        S[j-2] = j - 2;
-        goto visit;
-    }
-    else {
-        j++;
-    }
+    free(pos);
+    return ok;
+}
 
-increase:
-    // Try to increase S[j-1]
-    if (S[j-1] + 1 < S[j]) {
-        S[j-2] = S[j-1];
-        S[j-1]++;
-        goto visit;
+#if defined(KNUTH_BENCH)
+/******************* BENCHMARK *********************************/
+/* TECHGLISH: Compares, for each algorithm, the instantiation   */
+/* with an inlined checksum visitor, the function-pointer API   */
+/* with the same visitor, and (for Algorithm T) the same code   */
+/* written by hand with the checksum in place of the visit. All */
+/* the checksums must agree, and early stop is checked too.     */
+/*                                                              */
+/* NERDYTALIAN: Confronta, per ogni algoritmo, l'istanza con un */
+/* visitatore di checksum integrato, l'API con puntatore a      */
+/* funzione con lo stesso visitatore e (per l'Algoritmo T) lo   */
+/* stesso codice scritto a mano con il checksum al posto della  */
+/* visita. Tutti i checksum devono coincidere; si verifica      */
+/* anche l'interruzione anticipata.                             */
+/****************************************************************/
+
+typedef struct {
+    uint64_t chk;
+    uint64_t visite;
+    uint64_t limite;            /* Interruzione dopo limite visite */
+} Somma_t;
+
+static inline bool visitChecksum(const int* S, size_t k, void* ctx) {
+    Somma_t* s = (Somma_t*)ctx;
+    s->chk = s->chk * 31 + (uint64_t)S[0] * 7 + (uint64_t)S[k - 1];
+    return ++s->visite < s->limite;
+}
+
+#define VISIT_CHK(S, k, f, ctx) visitChecksum((S), (k), (ctx))
+
+DEFINE_T_KSUBSETLEX(T_ksubsetLex_chk, VISIT_CHK)
+DEFINE_R_KSUBSETRD(R_ksubsetRD_chk, VISIT_CHK)
+DEFINE_G_KSUBSETGOSPER(G_ksubsetGosper_chk, VISIT_CHK)
+
+/* Checksum sulle maschere, e lo stesso ricavato dall'array S */
+static inline bool visitMaskChecksum(uint64_t B, void* ctx) {
+    Somma_t* s = (Somma_t*)ctx;
+    s->chk = s->chk * 31 + B;
+    return ++s->visite < s->limite;
+}
+
+static bool visitArrayMask(const int* S, size_t k, void* ctx) {
+    uint64_t B = 0;
+    for (size_t i = 0; i < k; ++i) {
+        B |= 1ULL << S[i];
     }
-    else {
-        j++;
-        if (j <= k) goto decrease;
+    return visitMaskChecksum(B, ctx);
+}
+
+#define VISIT_MASK_CHK(B, f, ctx) visitMaskChecksum((B), (ctx))
+
+DEFINE_G_KSUBSETGOSPERMASK(G_ksubsetGosperMask_chk, VISIT_MASK_CHK)
+
+/* Consumatore incrementale: ogni variazione aggiorna la maschera in O(1) */
+typedef struct {
+    uint64_t B;
+    Somma_t  s;
+} Delta_t;
+
+static inline bool visitDeltaMask(int uscito, int entrato, void* ctx) {
+    Delta_t* d = (Delta_t*)ctx;
+    if (uscito >= 0) {
+        d->B ^= (1ULL << uscito) | (1ULL << entrato);
     }
+    return visitMaskChecksum(d->B, &d->s);
 }
 
-/******************* GOSPER'S ALGORITHM ************************/
-/* TECHGLISH: Implements Gosper's algorithm for generating all  */
-/* k-subsets using bitwise operations. This algorithm           */
-/* represents subsets as bit vectors and uses an elegant bit    */
-/* manipulation formula to generate the next combination,       */
-/* providing excellent performance for small universe sizes.    */
-/*                                                              */
-/* NERDYTALIAN: Implementa l'algoritmo di Gosper per generare   */
-/* tutti i k-sottoinsiemi utilizzando operazioni bit a bit.     */
-/* Questo algoritmo rappresenta i sottoinsiemi come vettori di  */
-/* bit e utilizza una formula elegante di manipolazione dei bit */
-/* per generare la combinazione successiva, offrendo eccellenti */
-/* prestazioni per universi di piccole dimensioni.              */
-/****************************************************************/
+#define VISIT_DELTA_CHK(S, k, f, ctx) visitDeltaMask(uscito, entrato, (ctx))
 
-void G_ksubsetGosper(const size_t k, const size_t n) {
-    // Initialize with first k-subset: binary representation 00...0011...11 (k ones)
+DEFINE_R_KSUBSETRD_T(R_ksubsetRDDelta_chk, DeltaVisitor_t, VISIT_DELTA_CHK)
+
+/* Gosper originale, con scansione O(n) dei bit e divisione */
+static uint64_t G_ksubsetGosper_div(const size_t k, const size_t n) {
+    int S[MAX_K + 2];
     uint64_t x = (1ULL << k) - 1;
     uint64_t limit = 1ULL << n;
-    
+    uint64_t chk = 0;
+
     while (x < limit) {
-        /* Convert bit representation to integer array for output */
-        size_t j = 0, mask = 1;
+        size_t j = 0;
+        uint64_t mask = 1;
         for (size_t i = 0; i < n; ++i) {
             if (x & mask) {
-                S[j++] = i;
+                S[j++] = (int)i;
             }
             mask <<= 1;
         }
-        printSubset(k);
-        
-        /* Generate the next k-subset using Gosper's hack */
-        uint64_t u = x & -x;           // Isolate rightmost 1-bit
-        uint64_t v = x + u;            // Turn off rightmost 1-bit and propagate carry
-        x = v + (((v ^ x) / u) >> 2);  // Add displaced bits
+        chk = chk * 31 + (uint64_t)S[0] * 7 + (uint64_t)S[k - 1];
+        {
+            uint64_t u = x & (~x + 1);
+            uint64_t v = x + u;
+            x = v + (((v ^ x) / u) >> 2);
+        }
+    }
+    return chk;
+}
+
+/* Algoritmo T con il checksum scritto a mano al posto della visita */
+static uint64_t T_ksubsetLex_mano(const size_t k, const size_t n) {
+    int S[MAX_K + 2];
+    const int K = (int)k;
+    int j, x;
+    uint64_t chk = 0;
+
+    for (j = 0; j < K; j++) {
+        S[j] = j;
+    }
+    j = K;
+    S[K] = (int)n;
+    S[K+1] = 0;
+
+visit:
+    chk = chk * 31 + (uint64_t)S[0] * 7 + (uint64_t)S[K - 1];
+    if (j > 0) {
+        x = j;
+        goto increment;
+    }
+    if (S[0] + 1 < S[1]) {
+        S[0]++;
+        goto visit;
+    }
+    j = 2;
+find_j:
+    S[j - 2] = j - 2;
+    x = S[j-1] + 1;
+    if (x == S[j]) {
+        j++;
+        goto find_j;
+    }
+    if (j > K) {
+        return chk;
+    }
+increment:
+    S[j-1] = x;
+    j--;
+    goto visit;
+}
+
+typedef bool (*Generatore_t)(const size_t, const size_t, Visitor_t, void*);
+typedef bool (*GeneratoreMask_t)(const size_t, const size_t, MaskVisitor_t, void*);
+
+/* Miglior tempo su 5 ripetizioni, in ns per subset */
+static double misura(Generatore_t g, size_t k, size_t n, Somma_t* s) {
+    double best = 1e30;
+    for (int r = 0; r < 5; ++r) {
+        clock_t t0 = clock();
+        s->chk = s->visite = 0;
+        s->limite = UINT64_MAX;
+        g(k, n, visitChecksum, s);
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / (double)s->visite;
+        if (t < best) {
+            best = t;
+        }
     }
+    return best;
 }
 
+static double misuraMask(GeneratoreMask_t g, size_t k, size_t n, Somma_t* s) {
+    double best = 1e30;
+    for (int r = 0; r < 5; ++r) {
+        clock_t t0 = clock();
+        s->chk = s->visite = 0;
+        s->limite = UINT64_MAX;
+        g(k, n, visitMaskChecksum, s);
+        double t = (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / (double)s->visite;
+        if (t < best) {
+            best = t;
+        }
+    }
+    return best;
+}
+
+int main(void) {
+    const size_t k = 6, n = 36;
+    static const char* nomi[] = {"T_ksubsetLex", "R_ksubsetRD", "G_ksubsetGosper"};
+    Generatore_t inline_g[] = {T_ksubsetLex_chk, R_ksubsetRD_chk, G_ksubsetGosper_chk};
+    Generatore_t fp_g[] = {T_ksubsetLex, R_ksubsetRD, G_ksubsetGosper};
+    Somma_t a, b;
+    size_t errori = 0;
+
+    printf("k = %zu, n = %zu: ns per subset\n", k, n);
+    for (int i = 0; i < 3; ++i) {
+        double t_in = misura(inline_g[i], k, n, &a);
+        double t_fp = misura(fp_g[i], k, n, &b);
+        errori += (a.chk != b.chk) || (a.visite != b.visite);
+        printf("%-16s inline %6.2f, puntatore %6.2f (%llu subset)\n", nomi[i],
+               t_in, t_fp, (unsigned long long)a.visite);
+
+        /* Interruzione anticipata a meta' */
+        b.chk = b.visite = 0;
+        b.limite = a.visite / 2;
+        errori += inline_g[i](k, n, NULL, &b) || (b.visite != b.limite);
+    }
+
+    /* Codice scritto a mano: miglior tempo su 5 ripetizioni */
+    {
+        double best = 1e30;
+        uint64_t chk = 0;
+        for (int r = 0; r < 5; ++r) {
+            clock_t t0 = clock();
+            chk = T_ksubsetLex_mano(k, n);
+            double t = (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / (double)a.visite;
+            if (t < best) {
+                best = t;
+            }
+        }
+        misura(T_ksubsetLex_chk, k, n, &a);
+        errori += (chk != a.chk);
+        printf("%-16s a mano %6.2f\n", nomi[0], best);
+    }
+
+    /* Algoritmo R come flusso di variazioni applicate a una maschera */
+    {
+        double best = 1e30;
+        Delta_t d;
+        for (int r = 0; r < 5; ++r) {
+            clock_t t0 = clock();
+            d.B = (1ULL << k) - 1;
+            d.s.chk = d.s.visite = 0;
+            d.s.limite = UINT64_MAX;
+            R_ksubsetRDDelta_chk(k, n, NULL, &d);
+            double t = (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / (double)d.s.visite;
+            if (t < best) {
+                best = t;
+            }
+        }
+        b.chk = b.visite = 0;
+        b.limite = UINT64_MAX;
+        R_ksubsetRD(k, n, visitArrayMask, &b);
+        errori += (d.s.chk != b.chk) || (d.s.visite != b.visite);
+        printf("%-16s variazioni su maschera %6.2f\n", nomi[1], best);
+    }
+
+    /* Gosper: versione originale, e maschere senza estrazione */
+    {
+        double best = 1e30;
+        uint64_t chk = 0;
+        for (int r = 0; r < 5; ++r) {
+            clock_t t0 = clock();
+            chk = G_ksubsetGosper_div(k, n);
+            double t = (double)(clock() - t0) / CLOCKS_PER_SEC * 1e9 / (double)a.visite;
+            if (t < best) {
+                best = t;
+            }
+        }
+        misura(G_ksubsetGosper_chk, k, n, &a);
+        errori += (chk != a.chk);
+        printf("%-16s O(n) e divisione %6.2f\n", nomi[2], best);
+
+        double t_in = misuraMask(G_ksubsetGosperMask_chk, k, n, &a);
+        double t_fp = misuraMask(G_ksubsetGosperMask, k, n, &b);
+        errori += (a.chk != b.chk) || (a.visite != b.visite);
+        printf("%-16s maschere: inline %6.2f, puntatore %6.2f\n", nomi[2], t_in, t_fp);
+
+        b.chk = b.visite = 0;
+        b.limite = UINT64_MAX;
+        G_ksubsetGosper(k, n, visitArrayMask, &b);
+        errori += (a.chk != b.chk) || (a.visite != b.visite);
+
+        b.chk = b.visite = 0;
+        b.limite = a.visite / 2;
+        errori += G_ksubsetGosperMask_chk(k, n, NULL, &b) || (b.visite != b.limite);
+
+        /* Universo di 64 elementi: l'ultimo subset occupa il bit 63 */
+        b.chk = b.visite = 0;
+        b.limite = UINT64_MAX;
+        errori += !G_ksubsetGosperMask(3, 64, visitMaskChecksum, &b) || (41664 != b.visite);
+        errori += G_ksubsetGosperMask(3, 65, visitMaskChecksum, &b);
+    }
+    printf("Checksum e interruzioni: %zu errori\n", errori);
+    return (0 == errori) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#elif !defined(KNUTH_LIB)
 /******************* MAIN PROGRAM *****************************/
 /* TECHGLISH: Command-line interface that runs all three       */
 /* algorithms on the same inputs for comparison. Takes k       */
@@ -284,18 +880,67 @@ void G_ksubsetGosper(const size_t k, const size_t n) {
 /* k (dimensione del sottoinsieme) e n (dimensione             */
 /* dell'universo) come parametri ed esegue la validazione per  */
 /* garantire che i vincoli siano soddisfatti.                  */
+/*                                                             */
+/* TECHGLISH: -t and -b write the delta stream of Algorithm R  */
+/* instead, as text on stdout or in binary to a file; -x       */
+/* decodes either one and prints the subsets as R_ksubsetRD.   */
+/*                                                             */
+/* NERDYTALIAN: -t e -b scrivono invece il flusso di variazioni*/
+/* dell'Algoritmo R, testuale su stdout o binario su file; -x  */
+/* decodifica entrambi e stampa i sottoinsiemi come R_ksubsetRD*/
 /***************************************************************/
 
+static void uso(const char* nome) {
+    fprintf(stderr, "Uso: %s [-t | -b file.rd] k n, con 2 < k < n\n", nome);
+    fprintf(stderr, "     %s -x file.rd\n", nome);
+}
+
 int main(int argc, char* argv[]) {
     size_t k, n;
+    const char* delta = NULL;   // File del flusso di variazioni, "-" per stdout
+    bool binario = false;
+    int arg = 1;
+
+    // Decodifica di un flusso di variazioni
+    if ((3 == argc) && (0 == strcmp(argv[1], "-x"))) {
+        FILE* in = fopen(argv[2], "rb");
+        if (NULL == in) {
+            fprintf(stderr, "Impossibile aprire %s\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+        bool ok = deltaLeggiHeader(in, &k, &n, &binario);
+        if (ok) {
+            printf("R_ksubsetRD(%zu, %zu) dal flusso %s %s:\n", k, n,
+                   binario ? "binario" : "testuale", argv[2]);
+            TotalSet = 0;
+            ok = deltaDecodifica(in, k, n, binario, printSubset, NULL);
+            printf("%zu subset generati\n", TotalSet);
+        }
+        fclose(in);
+        if (!ok) {
+            fprintf(stderr, "Flusso di variazioni non valido: %s\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
 
-    if (3 != argc) {
-        fprintf(stderr, "Uso: %s k n, con 2 < k < n\n", argv[0]);
+    if ((argc > 1) && (0 == strcmp(argv[1], "-t"))) {
+        delta = "-";
+        arg = 2;
+    }
+    else if ((argc > 2) && (0 == strcmp(argv[1], "-b"))) {
+        delta = argv[2];
+        binario = true;
+        arg = 3;
+    }
+
+    if (arg + 2 != argc) {
+        uso(argv[0]);
         return EXIT_FAILURE;
     }
 
-    k = (size_t)atoi(argv[1]);
-    n = (size_t)atoi(argv[2]);
+    k = (size_t)atoi(argv[arg]);
+    n = (size_t)atoi(argv[arg + 1]);
 
     // Controllo valore minimo di k
     if (k < 3) {
@@ -315,34 +960,50 @@ int main(int argc, char* argv[]) {
         fprintf(stderr, "Uso: %s k n, con k < n\n", argv[0]);
         return EXIT_FAILURE;
     }
-        
-    S = (int*)malloc((k + 3) * sizeof(int));
-    if (NULL == S)
-    {
-        fputs("Errore di allocazione!\n", stderr);
-        return EXIT_FAILURE;
+
+    // Flusso di variazioni dell'Algoritmo R al posto dei sottoinsiemi
+    if (NULL != delta) {
+        if (binario && (n > DELTA_MAX_N)) {
+            fprintf(stderr, "Il formato binario richiede n <= %d.\n", DELTA_MAX_N);
+            return EXIT_FAILURE;
+        }
+        FILE* out = binario ? fopen(delta, "wb") : stdout;
+        if (NULL == out) {
+            fprintf(stderr, "Impossibile creare %s\n", delta);
+            return EXIT_FAILURE;
+        }
+        bool ok = deltaScriviHeader(out, k, n, binario)
+                  && R_ksubsetRDDelta(k, n, binario ? deltaBinario : deltaTesto, out);
+        ok = (0 == fflush(out)) && ok;
+        if (binario) {
+            ok = (0 == fclose(out)) && ok;
+        }
+        if (!ok) {
+            fprintf(stderr, "Errore di scrittura del flusso di variazioni\n");
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
     }
 
     // Run Algorithm T (lexicographic order)
-    printf("T_ksubsetLex(%d, %d) per ordine lex:\n", k, n);
+    printf("T_ksubsetLex(%zu, %zu) per ordine lex:\n", k, n);
     TotalSet = 0;
-    T_ksubsetLex(k, n);
+    T_ksubsetLex(k, n, printSubset, NULL);
     printf("%zu subset generati\n", TotalSet);
 
     // Run Algorithm R (revdoor/Gray code order)
-    printf("\nR_ksubsetRD(%d, %d) per ordine revdoor (Gray):\n", k, n);
+    printf("\nR_ksubsetRD(%zu, %zu) per ordine revdoor (Gray):\n", k, n);
     TotalSet = 0;
-    R_ksubsetRD(k, n);
+    R_ksubsetRD(k, n, printSubset, NULL);
     printf("%zu subset generati\n", TotalSet);
 
     // Run Gosper's algorithm
-    printf("\nG_ksubsetGosper(%d, %d):\n", k, n);
+    printf("\nG_ksubsetGosper(%zu, %zu):\n", k, n);
     TotalSet = 0;
-    G_ksubsetGosper(k, n);
+    G_ksubsetGosper(k, n, printSubset, NULL);
     printf("%zu subset generati\n", TotalSet);
-    
-    free(S);
 
     return EXIT_SUCCESS;
 }
-/** EOF: Knuth.c **/
\ No newline at end of file
+#endif
+/** EOF: Knuth.c **/
@@ -35,8 +35,11 @@
 /**********************************************************************/
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
+#include "Generators.h"
 
 /******************* CONSTANTS ***********************************/
 /* TECHGLISH: The maximum universe size is limited by the number */
@@ -67,7 +70,7 @@
 /* l'output) viene visualizzato tra parentesi graffe.            */
 /*****************************************************************/
 
-void printSubset(uint64_t B, size_t n) {
+static void printSubset(uint64_t B, size_t n) {
     printf("{ ");
     for (size_t i = 0; i < n; ++i) {
         if (B & (1ULL << i)) {
@@ -90,18 +93,12 @@ void printSubset(uint64_t B, size_t n) {
 /* producendo esattamente k*(n-k) nuovi sottoinsiemi.             */
 /******************************************************************/
 
-void generateHammingDistance1(size_t k, size_t n) {
-    // Contatore per i sottoinsiemi generati
-    size_t counter = 0;
-
+// Visitatore MaskVisitor_t: vedi Generators.h
+bool visitHammingDistance1(size_t k, size_t n, MaskVisitor_t f, void* ctx) {
     // Inizializza il subset base con i primi k bit impostati a 1
     // Es. per k = 3: B = 0b111 = 7 = 2^3 -1
     uint64_t B = (1ULL << k) - 1; 
 
-    // Stampa il subset base per riferimento
-    printf("Base subset:\n");
-    printSubset(B, n);
-
     // Genera tutti i subset a semidistanza di Hamming unitaria
     for (size_t i = 0; i < k; ++i) {
         // Azzera il bit i-esimo del subset base (rimuovi elemento i)
@@ -113,20 +110,38 @@ void generateHammingDistance1(size_t k, size_t n) {
             uint64_t set_mask = (1ULL << j);
 
             // Modifica il subset: rimuovi i, aggiungi j
-            uint64_t modified = (B & clear_mask) | set_mask;
-
-            // Incrementa il contatore e stampa il subset
-            ++counter;
-            printSubset(modified, n);
-
-            // Controllo overflow del contatore
-            if (counter == SIZE_MAX) {
-                fprintf(stderr, "Errore: raggiunto il limite massimo di conteggio. Terminazione.\n");
-                exit(EXIT_FAILURE);
+            if (!f((B & clear_mask) | set_mask, ctx)) {
+                return false;
             }
         }
     }
-    printf("\nTotale subset generati: %zu\n", counter);
+    return true;
+}
+
+// Contesto del visitatore di stampa
+typedef struct {
+    size_t n;
+    size_t counter;
+} Stampa_t;
+
+static bool visitPrint(uint64_t B, void* ctx) {
+    Stampa_t* s = (Stampa_t*)ctx;
+    // Incrementa il contatore e stampa il subset
+    ++s->counter;
+    printSubset(B, s->n);
+    return true;
+}
+
+void generateHammingDistance1(size_t k, size_t n) {
+    // Contatore per i sottoinsiemi generati
+    Stampa_t s = {n, 0};
+
+    // Stampa il subset base per riferimento
+    printf("Base subset:\n");
+    printSubset((1ULL << k) - 1, n);
+
+    visitHammingDistance1(k, n, visitPrint, &s);
+    printf("\nTotale subset generati: %zu\n", s.counter);
 }
 
 /******************* MAIN PROGRAM *******************************/
@@ -142,6 +157,7 @@ void generateHammingDistance1(size_t k, size_t n) {
 /* necessari prima di procedere con la generazione.              */
 /*****************************************************************/
 
+#if !defined(KSUBSET_LIB)
 int main(int argc, char *argv[]) {
     // Argomenti da linea di comando
     if (argc != 3) {
@@ -178,4 +194,5 @@ int main(int argc, char *argv[]) {
 
     return EXIT_SUCCESS;
 }
+#endif
 /** EOF: ksubset_DL.c **/
\ No newline at end of file
@@ -0,0 +1,666 @@
+/************************************************************************/
+/* Libreria per la generazione di disegni (v,k,1) ciclici con k = 3..5,
+** tramite famiglie di differenze, a complemento di STSC.lib che tratta
+** il solo caso k = 3 con le formule di Peltesohn.
+**
+** Una famiglia di differenze (v,k,1) in Z_v e' un insieme di blocchi base
+** le cui differenze coprono ogni elemento non nullo di Z_v esattamente una
+** volta (escluse, se v = k mod k(k-1), quelle dell'orbita corta
+** {0, v/k, 2v/k, ...}). Lo sviluppo ciclico dei blocchi base produce il
+** BIBD, esattamente come le terne differenza producono lo STS ciclico.
+**
+** Riferimenti:
+** R. Julian R. Abel, Marco Buratti, 2006.
+** "Difference families".
+** In: C.J. Colbourn, J.H. Dinitz (eds.), Handbook of Combinatorial
+** Designs, 2nd ed., Chapman & Hall/CRC, pp. 392-410.
+**
+** Le famiglie trovate vengono salvate in formato testo nella directory di
+** cache di STSC_gen, quindi ogni ordine viene cercato una sola volta.
+**
+** Compilare come eseguibile abilitando il simbolo BIBD_TEST per un test
+** run automatico, oppure BIBD_BENCH per il benchmark sugli ordini
+** ammissibili fino ad alcune centinaia.
+**
+** Funzioni esportate:
+**   bool Convalida_BIBD(size_t v, size_t k);
+**   size_t Totale_blocchi_BIBD(size_t v, size_t k);
+**   bool Cerca_famiglia(size_t v, size_t k, uint64_t max_nodi, Famiglia_t* f);
+**   bool Famiglia_differenze(size_t v, size_t k, Famiglia_t* f);
+**   bool Convalida_famiglia(const Famiglia_t* f);
+**   size_t Sviluppa_famiglia(const Famiglia_t* f, uint32_t* blocchi);
+**   void Libera_famiglia(Famiglia_t* f);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+ #include <direct.h>
+#endif
+#include "BIBD.h"
+
+#define DF_PATH_MAX 260
+
+// Stato della ricerca con backtracking
+typedef struct {
+    uint32_t  v;
+    uint32_t  k;
+    uint32_t  nb;
+    uint32_t* base;
+    uint64_t* usate;        // Bit per ogni differenza ripiegata 1..v/2
+    uint64_t  nodi;
+    uint64_t  max_nodi;
+    uint64_t  seme;         // Stato xorshift per l'ordine dei candidati
+} Ricerca_t;
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+#define BIT(m, x)     (((m)[(x) >> 6] >> ((x) & 63)) & 1U)
+#define SET(m, x)     ((m)[(x) >> 6] |= 1ULL << ((x) & 63))
+#define CLR(m, x)     ((m)[(x) >> 6] &= ~(1ULL << ((x) & 63)))
+
+// Differenza ripiegata in 1..v/2
+static uint32_t ripiega(uint32_t x, uint32_t v) {
+    return (x > v / 2) ? v - x : x;
+}
+
+static bool blocco(Ricerca_t* R, uint32_t i);
+
+/*
+** Sceglie l'elemento j del blocco i, maggiore di ymin. Le differenze con
+** gli elementi gia' scelti devono essere libere e distinte tra loro.
+** I candidati sono visitati ciclicamente da una posizione pseudocasuale,
+** cosi' che ogni ripartenza esplori una diversa regione dell'albero.
+*/
+static bool elemento(Ricerca_t* R, uint32_t i, uint32_t j, uint32_t ymin) {
+    const uint32_t v = R->v;
+    const uint32_t n = (ymin < v) ? v - ymin : 0;
+    uint32_t* B = R->base + (size_t)i * R->k;
+    uint32_t r = 0;
+
+    if (j == R->k) {
+        return blocco(R, i + 1);
+    }
+
+    if (n > 0) {
+        R->seme ^= R->seme << 13;
+        R->seme ^= R->seme >> 7;
+        R->seme ^= R->seme << 17;
+        r = (uint32_t)(R->seme % n);
+    }
+    for (uint32_t c = 0; c < n; ++c) {
+        const uint32_t y = ymin + ((c < n - r) ? c + r : c + r - n);
+        uint32_t d[BIBD_K_MAX];
+        bool ok = true;
+
+        if (++R->nodi > R->max_nodi) {
+            return false;
+        }
+        for (uint32_t e = 0; ok && (e < j); ++e) {
+            d[e] = ripiega(y - B[e], v);
+            ok = !BIT(R->usate, d[e]);
+            for (uint32_t h = 0; ok && (h < e); ++h) {
+                ok = (d[h] != d[e]);
+            }
+        }
+        if (!ok) {
+            continue;
+        }
+
+        for (uint32_t e = 0; e < j; ++e) {
+            SET(R->usate, d[e]);
+        }
+        B[j] = y;
+        if (elemento(R, i, j + 1, y + 1)) {
+            return true;
+        }
+        for (uint32_t e = 0; e < j; ++e) {
+            CLR(R->usate, d[e]);
+        }
+    }
+    return false;
+}
+
+/*
+** Il blocco i copre la minima differenza libera d, nella forma {0, d, ...}.
+** Ogni altra differenza nuova deve essere maggiore di d, quindi gli
+** elementi restanti partono da 2d + 1.
+*/
+static bool blocco(Ricerca_t* R, uint32_t i) {
+    uint32_t* B;
+    uint32_t d = 1;
+    bool ok;
+
+    if (i == R->nb) {
+        return true;
+    }
+    while (BIT(R->usate, d)) {
+        ++d;
+    }
+
+    B = R->base + (size_t)i * R->k;
+    B[0] = 0;
+    B[1] = d;
+    SET(R->usate, d);
+    ok = elemento(R, i, 2, 2 * d + 1);
+    if (!ok) {
+        CLR(R->usate, d);
+    }
+    return ok;
+}
+
+/*
+** Ricerca completa con ripartenze: ogni tentativo ha un budget del 25%
+** superiore al precedente, fino a esaurire il budget complessivo.
+*/
+static bool ricerca(Ricerca_t* R, bool corta, uint64_t max_nodi) {
+    const size_t parole = R->v / 128 + 1;
+    uint64_t tentativo = 1000;
+    uint64_t totale = 0;
+    bool ok = false;
+
+    R->seme = 88172645463325252ULL;
+    while (!ok && (totale < max_nodi)) {
+        memset(R->usate, 0, parole * sizeof(uint64_t));
+        // Le differenze dell'orbita corta sono escluse in partenza
+        if (corta) {
+            for (uint32_t j = 1; j < R->k; ++j) {
+                SET(R->usate, ripiega(j * (R->v / R->k), R->v));
+            }
+        }
+        R->nodi = 0;
+        R->max_nodi = (tentativo < max_nodi - totale) ? tentativo : max_nodi - totale;
+        ok = blocco(R, 0);
+        totale += R->nodi;
+        tentativo += tentativo / 4;
+    }
+    R->nodi = totale;
+    return ok;
+}
+
+static bool primo(uint32_t p) {
+    if (p < 2) {
+        return false;
+    }
+    for (uint32_t d = 2; (uint64_t)d * d <= p; ++d) {
+        if (0 == p % d) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+** Costruzione di Wilson per p primo, p = k(k-1)t + 1. Sia C il sottogruppo
+** di Z_p^* di indice m = k(k-1)/2, di ordine 2t, che contiene -1. Se le m
+** differenze b_j - b_i (i < j) di un blocco B cadono in classi laterali di
+** C distinte, i blocchi w^(mi) * B, i = 0..t-1, formano una famiglia di
+** differenze (famiglia radicale). Il blocco B = {0, 1, b_2, ...} viene
+** cercato in ordine lessicografico, con i logaritmi discreti in tabella.
+*/
+static bool wilson_elemento(Ricerca_t* R, const uint32_t* lg, uint32_t m,
+                            uint32_t* B, uint32_t j, bool* classi) {
+    const uint32_t p = R->v;
+
+    if (j == R->k) {
+        return true;
+    }
+    for (uint32_t y = B[j - 1] + 1; y < p; ++y) {
+        uint32_t c[BIBD_K_MAX];
+        bool ok = true;
+
+        if (++R->nodi > R->max_nodi) {
+            return false;
+        }
+        for (uint32_t e = 0; ok && (e < j); ++e) {
+            c[e] = lg[y - B[e]] % m;
+            ok = !classi[c[e]];
+            for (uint32_t h = 0; ok && (h < e); ++h) {
+                ok = (c[h] != c[e]);
+            }
+        }
+        if (!ok) {
+            continue;
+        }
+        for (uint32_t e = 0; e < j; ++e) {
+            classi[c[e]] = true;
+        }
+        B[j] = y;
+        if (wilson_elemento(R, lg, m, B, j + 1, classi)) {
+            return true;
+        }
+        for (uint32_t e = 0; e < j; ++e) {
+            classi[c[e]] = false;
+        }
+    }
+    return false;
+}
+
+static int confronta(const void* a, const void* b) {
+    const uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static bool wilson(Ricerca_t* R, uint64_t max_nodi) {
+    const uint32_t p = R->v, k = R->k, m = k * (k - 1) / 2;
+    uint32_t B[BIBD_K_MAX] = {0, 1};
+    bool classi[BIBD_K_MAX * (BIBD_K_MAX - 1) / 2] = {false};
+    uint32_t* lg;
+    uint32_t g, x, w;
+    bool ok;
+
+    lg = (uint32_t*)malloc(p * sizeof(uint32_t));
+    if (NULL == lg) {
+        return false;
+    }
+
+    // Radice primitiva minima e tabella dei logaritmi discreti
+    for (g = 2; ; ++g) {
+        x = 1;
+        for (uint32_t e = 1; e < p - 1; ++e) {
+            x = (uint32_t)((uint64_t)x * g % p);
+            if (1 == x) {
+                break;
+            }
+        }
+        if (1 != x) {
+            break;
+        }
+    }
+    x = 1;
+    for (uint32_t e = 0; e < p - 1; ++e) {
+        lg[x] = e;
+        x = (uint32_t)((uint64_t)x * g % p);
+    }
+
+    R->nodi = 0;
+    R->max_nodi = max_nodi;
+    classi[0] = true;       // Differenza 1 - 0, logaritmo 0
+    ok = wilson_elemento(R, lg, m, B, 2, classi);
+    free(lg);
+    if (!ok) {
+        return false;
+    }
+
+    // Blocchi w^(mi) * B, w = g^m
+    w = 1;
+    for (uint32_t e = 0; e < m; ++e) {
+        w = (uint32_t)((uint64_t)w * g % p);
+    }
+    x = 1;
+    for (uint32_t i = 0; i < R->nb; ++i) {
+        uint32_t* D = R->base + (size_t)i * k;
+        for (uint32_t e = 0; e < k; ++e) {
+            D[e] = (uint32_t)((uint64_t)B[e] * x % p);
+        }
+        qsort(D, k, sizeof(uint32_t), confronta);
+        x = (uint32_t)((uint64_t)x * w % p);
+    }
+    return true;
+}
+
+static const char* df_dir(void) {
+    const char* dir = getenv(DF_CACHE_ENV);
+    return ((NULL != dir) && ('\0' != dir[0])) ? dir : DF_CACHE_DIR;
+}
+
+static void df_nome(char* nome, size_t len, size_t v, size_t k) {
+    snprintf(nome, len, "%s/DF_v%05zu_k%zu.txt", df_dir(), v, k);
+}
+
+// Esito della lettura dalla cache
+typedef enum {
+    DF_ASSENTE,             // Nessun file valido: occorre la ricerca
+    DF_TROVATA,             // Famiglia letta e riconvalidata
+    DF_ESAURITA             // Ricerca gia' fallita con un budget non inferiore
+} df_esito_t;
+
+/*
+** Legge una famiglia dalla cache. Il file contiene la famiglia ("DF v k
+** nb corta" e i blocchi base) oppure l'esito negativo di una ricerca
+** ("NF v k budget"); i file non validi vengono rimossi.
+*/
+static df_esito_t df_carica(size_t v, size_t k, uint64_t max_nodi, Famiglia_t* f) {
+    char nome[DF_PATH_MAX];
+    char tag[3] = "";
+    unsigned fv, fk, fnb, fc;
+    unsigned long long budget;
+    FILE* fp;
+    bool ok;
+
+    memset(f, 0, sizeof(*f));
+    df_nome(nome, sizeof(nome), v, k);
+    fp = fopen(nome, "r");
+    if (NULL == fp) {
+        return DF_ASSENTE;
+    }
+    if ((1 == fscanf(fp, "%2s", tag)) && (0 == strcmp(tag, "NF"))) {
+        ok = (3 == fscanf(fp, "%u %u %llu", &fv, &fk, &budget)) && (fv == v) && (fk == k);
+        fclose(fp);
+        if (ok && (budget >= max_nodi)) {
+            return DF_ESAURITA;
+        }
+        // Record corrotto, o budget cresciuto: la ricerca va ripetuta
+        remove(nome);
+        return DF_ASSENTE;
+    }
+    ok = (0 == strcmp(tag, "DF")) &&
+         (4 == fscanf(fp, "%u %u %u %u", &fv, &fk, &fnb, &fc)) &&
+         (fv == v) && (fk == k) && (fnb <= v);
+    if (ok) {
+        f->v = fv;
+        f->k = fk;
+        f->nb = fnb;
+        f->corta = (0 != fc);
+        f->nodi = 0;
+        f->base = (uint32_t*)malloc(((size_t)fnb * fk + 1) * sizeof(uint32_t));
+        ok = (NULL != f->base);
+        for (size_t i = 0; ok && (i < (size_t)fnb * fk); ++i) {
+            ok = (1 == fscanf(fp, "%u", &f->base[i])) && (f->base[i] < v);
+        }
+    }
+    fclose(fp);
+
+    ok = ok && Convalida_famiglia(f);
+    if (!ok) {
+        Libera_famiglia(f);
+        remove(nome);
+    }
+    return ok ? DF_TROVATA : DF_ASSENTE;
+}
+
+// Salva la famiglia f, oppure (f == NULL) il fallimento della ricerca di (v,k)
+static void df_salva(size_t v, size_t k, uint64_t max_nodi, const Famiglia_t* f) {
+    char nome[DF_PATH_MAX];
+    FILE* fp;
+
+#ifdef _WIN32
+    _mkdir(df_dir());
+#else
+    mkdir(df_dir(), 0755);
+#endif
+    df_nome(nome, sizeof(nome), v, k);
+    fp = fopen(nome, "w");
+    if (NULL == fp) {
+        return;
+    }
+    if (NULL == f) {
+        fprintf(fp, "NF %zu %zu %llu\n", v, k, (unsigned long long)max_nodi);
+    } else {
+        fprintf(fp, "DF %u %u %u %u\n", f->v, f->k, f->nb, f->corta ? 1U : 0U);
+        for (uint32_t i = 0; i < f->nb; ++i) {
+            for (uint32_t j = 0; j < f->k; ++j) {
+                fprintf(fp, (j + 1 < f->k) ? "%u " : "%u\n", f->base[(size_t)i * f->k + j]);
+            }
+        }
+    }
+    if (0 != fclose(fp)) {
+        remove(nome);
+    }
+}
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+bool Convalida_BIBD(size_t v, size_t k) {
+    size_t m = k * (k - 1);
+    return (k >= BIBD_K_MIN) && (k <= BIBD_K_MAX) && (v > k) &&
+           (v <= UINT32_MAX) && ((v % m == 1) || (v % m == k));
+}
+
+size_t Totale_blocchi_BIBD(size_t v, size_t k) {
+    return v * (v - 1U) / (k * (k - 1U));
+}
+
+bool Cerca_famiglia(size_t v, size_t k, uint64_t max_nodi, Famiglia_t* f) {
+    Ricerca_t R;
+    bool ok;
+
+    memset(f, 0, sizeof(*f));
+    if (!Convalida_BIBD(v, k)) {
+        fprintf(stderr, ">> LIB_BIBD.Cerca_famiglia(): ERRORE\n"
+                ">>    Controllo di congruenza fallito per (%zu,%zu,1)\n\n", v, k);
+        return false;
+    }
+
+    f->v = (uint32_t)v;
+    f->k = (uint32_t)k;
+    f->corta = (v % (k * (k - 1)) == k);
+    f->nb = (uint32_t)((v - (f->corta ? k : 1)) / (k * (k - 1)));
+
+    R.v = f->v;
+    R.k = f->k;
+    R.nb = f->nb;
+    R.nodi = 0;
+    if (0 == max_nodi) {
+        max_nodi = DF_MAX_NODI;
+    }
+    R.base = (uint32_t*)malloc(((size_t)f->nb * k + 1) * sizeof(uint32_t));
+    R.usate = (uint64_t*)calloc(v / 128 + 1, sizeof(uint64_t));
+    if ((NULL == R.base) || (NULL == R.usate)) {
+        fputs("Errore di allocazione!\n", stderr);
+        free(R.base);
+        free(R.usate);
+        return false;
+    }
+
+    // Per v primo la famiglia radicale, se esiste, si trova quasi subito
+    ok = !f->corta && primo(f->v) && wilson(&R, max_nodi);
+    f->nodi = R.nodi;
+    if (!ok) {
+        ok = ricerca(&R, f->corta, max_nodi - (f->nodi < max_nodi ? f->nodi : max_nodi));
+        f->nodi += R.nodi;
+    }
+    free(R.usate);
+    if (ok) {
+        f->base = R.base;
+    } else {
+        free(R.base);
+    }
+    return ok;
+}
+
+bool Famiglia_differenze(size_t v, size_t k, Famiglia_t* f) {
+    memset(f, 0, sizeof(*f));
+    if (!Convalida_BIBD(v, k)) {
+        fprintf(stderr, ">> LIB_BIBD.Famiglia_differenze(): ERRORE\n"
+                ">>    Controllo di congruenza fallito per (%zu,%zu,1)\n\n", v, k);
+        return false;
+    }
+    switch (df_carica(v, k, DF_MAX_NODI, f)) {
+    case DF_TROVATA:
+        return true;
+    case DF_ESAURITA:
+        return false;
+    default:
+        break;
+    }
+    if (!Cerca_famiglia(v, k, DF_MAX_NODI, f)) {
+        // Solo un budget esaurito va ricordato, non un errore di allocazione
+        if (f->nodi >= DF_MAX_NODI) {
+            df_salva(v, k, DF_MAX_NODI, NULL);
+        }
+        return false;
+    }
+    df_salva(v, k, DF_MAX_NODI, f);
+    return true;
+}
+
+bool Convalida_famiglia(const Famiglia_t* f) {
+    const uint32_t v = f->v, k = f->k;
+    uint8_t* cnt;
+    bool ok = (NULL != f->base) || (0 == f->nb);
+
+    if (!ok || !Convalida_BIBD(v, k) ||
+        (f->corta != (v % (k * (k - 1)) == k)) ||
+        (f->nb != (v - (f->corta ? k : 1)) / (k * (k - 1)))) {
+        return false;
+    }
+    cnt = (uint8_t*)calloc(v / 2 + 1, sizeof(uint8_t));
+    if (NULL == cnt) {
+        return false;
+    }
+    if (f->corta) {
+        for (uint32_t j = 1; j < k; ++j) {
+            cnt[ripiega(j * (v / k), v)] = 1;
+        }
+    }
+    for (uint32_t i = 0; ok && (i < f->nb); ++i) {
+        const uint32_t* B = f->base + (size_t)i * k;
+        for (uint32_t x = 0; ok && (x < k); ++x) {
+            for (uint32_t y = x + 1; ok && (y < k); ++y) {
+                uint32_t d = ripiega((B[y] + v - B[x]) % v, v);
+                ok = (B[x] < v) && (B[y] < v) && (0 != d) && (0 == cnt[d]);
+                if (ok) {
+                    cnt[d] = 1;
+                }
+            }
+        }
+    }
+    for (uint32_t d = 1; ok && (d <= v / 2); ++d) {
+        ok = (1 == cnt[d]);
+    }
+    free(cnt);
+    return ok;
+}
+
+size_t Sviluppa_famiglia(const Famiglia_t* f, uint32_t* blocchi) {
+    const uint32_t v = f->v, k = f->k;
+    uint32_t x[BIBD_K_MAX];
+    size_t bc = 0;
+
+    // Orbite complete: traslazione incrementale con riduzione per confronto
+    for (uint32_t i = 0; i < f->nb; ++i) {
+        memcpy(x, f->base + (size_t)i * k, k * sizeof(uint32_t));
+        for (uint32_t j = 0; j < v; ++j) {
+            memcpy(blocchi + bc * k, x, k * sizeof(uint32_t));
+            ++bc;
+            for (uint32_t e = 0; e < k; ++e) {
+                if (++x[e] == v) x[e] = 0;
+            }
+        }
+    }
+
+    // Orbita corta: {j, j + v/k, ..., j + (k-1)v/k}, j < v/k
+    if (f->corta) {
+        const uint32_t s = v / k;
+        for (uint32_t j = 0; j < s; ++j) {
+            for (uint32_t e = 0; e < k; ++e) {
+                blocchi[bc * k + e] = j + e * s;
+            }
+            ++bc;
+        }
+    }
+    return bc;
+}
+
+void Libera_famiglia(Famiglia_t* f) {
+    free(f->base);
+    f->base = NULL;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(BIBD_TEST)
+// Verifica diretta sul disegno sviluppato: ogni coppia una sola volta
+static bool verifica_disegno(const Famiglia_t* f) {
+    const size_t v = f->v, k = f->k, b = Totale_blocchi_BIBD(v, k);
+    uint32_t* blocchi = (uint32_t*)malloc(b * k * sizeof(uint32_t));
+    uint8_t* coppie = (uint8_t*)calloc(v * v, 1);
+    bool ok = (NULL != blocchi) && (NULL != coppie) &&
+              (Sviluppa_famiglia(f, blocchi) == b);
+
+    for (size_t i = 0; ok && (i < b); ++i) {
+        const uint32_t* B = blocchi + i * k;
+        for (size_t x = 0; ok && (x < k); ++x) {
+            for (size_t y = x + 1; ok && (y < k); ++y) {
+                ok = (B[x] != B[y]) && !coppie[B[x] * v + B[y]];
+                coppie[B[x] * v + B[y]] = coppie[B[y] * v + B[x]] = 1;
+            }
+        }
+    }
+    free(blocchi);
+    free(coppie);
+    return ok;
+}
+
+int main() {
+    size_t fallimenti = 0;
+
+    for (size_t k = BIBD_K_MIN; k <= BIBD_K_MAX; ++k) {
+        for (size_t v = k + 1; v <= 130; ++v) {
+            Famiglia_t f;
+            bool ok;
+            if (!Convalida_BIBD(v, k)) {
+                continue;
+            }
+            if (!Cerca_famiglia(v, k, 50000000ULL, &f)) {
+                printf("** (%3zu,%zu,1): nessuna famiglia ciclica entro il budget\n", v, k);
+                continue;
+            }
+            ok = Convalida_famiglia(&f) && verifica_disegno(&f);
+            printf("** (%3zu,%zu,1): %2u blocchi base%s, %10llu nodi, %s\n", v, k, f.nb,
+                   f.corta ? " + orbita corta" : "", (unsigned long long)f.nodi,
+                   ok ? "verificato" : "ERRATO");
+            fallimenti += !ok;
+            Libera_famiglia(&f);
+        }
+    }
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#elif defined(BIBD_BENCH)
+#include <time.h>
+
+/*
+** Benchmark sugli ordini ammissibili: prima esecuzione con ricerca,
+** seconda dalla cache, piu' lo sviluppo del disegno.
+*/
+int main() {
+    printf("%5s %2s %12s %10s %10s %10s\n", "v", "k", "nodi", "ricerca", "cache", "sviluppo");
+    for (size_t k = 4; k <= BIBD_K_MAX; ++k) {
+        for (size_t v = k + 1; v <= 400; ++v) {
+            Famiglia_t f;
+            clock_t t0;
+            double tr, tc, ts;
+            uint64_t nodi;
+            uint32_t* blocchi;
+
+            if (!Convalida_BIBD(v, k) || (v % (k * (k - 1)) != 1)) {
+                continue;
+            }
+            t0 = clock();
+            if (!Famiglia_differenze(v, k, &f)) {
+                printf("%5zu %2zu %12s\n", v, k, "-");
+                continue;
+            }
+            tr = (double)(clock() - t0) / CLOCKS_PER_SEC;
+            nodi = f.nodi;
+            Libera_famiglia(&f);
+            t0 = clock();
+            Famiglia_differenze(v, k, &f);
+            tc = (double)(clock() - t0) / CLOCKS_PER_SEC;
+            blocchi = (uint32_t*)malloc(Totale_blocchi_BIBD(v, k) * k * sizeof(uint32_t));
+            t0 = clock();
+            Sviluppa_famiglia(&f, blocchi);
+            ts = (double)(clock() - t0) / CLOCKS_PER_SEC;
+            printf("%5zu %2zu %12llu %10.4f %10.4f %10.4f\n", v, k,
+                   (unsigned long long)nodi, tr, tc, ts);
+            free(blocchi);
+            Libera_famiglia(&f);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+#endif
+/** EOF: BIBD.c **/
@@ -10,19 +10,24 @@
 **   - Implementa un generatore di QLCI basato su schemi combinatori rotazionali.
 **   - Genera QLCI per diverse dimensioni specificate a compile-time.
 **   - Utilizza a titolo llustrativo best practice di allocazione.
+**   - Rappresentazione implicita: si memorizza la sola riga 0 (memoria O(n)),
+**     le righe sono materializzate su richiesta con rotazioni via memcpy().
+**   - Compilare abilitando il simbolo QLCI_BENCH per il benchmark con
+**     n = 10^6, oppure QLCI_LIB per includerlo senza main() (test di
+**     Torneo.c).
 **
 **********************************************************************************
 ** Nota teorica fondamentale: NON esistono QLCI di ordine PARI.
 **********************************************************************************
 **
 ** METRICHE:
-**   - Lines of Code (LOC)....................: 175
-**   - Source Lines of Code (SLOC)............: 118
-**   - Comment Lines (CLOC)...................: 57
-**   - Comment to Code Ratio (CCR)............: 0.48
-**   - Cyclomatic Complexity (CC).............: 7
-**   - Function Count.........................: 4
-**   - Average Function Length................: 18 SLOC
+**   - Lines of Code (LOC)....................: 323
+**   - Source Lines of Code (SLOC)............: 130
+**   - Comment Lines (CLOC)...................: 171
+**   - Comment to Code Ratio (CCR)............: 1.32
+**   - Cyclomatic Complexity (CC).............: 36
+**   - Function Count.........................: 8
+**   - Average Function Length................: 14 SLOC
 **
 ** Licenza: MIT License
 ** Copyright (C) 2000-2025 M.A.W. 1968
@@ -31,6 +36,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 
 /**
@@ -39,144 +45,226 @@
  * Nel caso non fosse chiaro a sufficienza, tutti i valori qui 
  * indicati DEVONO essere dispari.
  */
+#if !defined(QLCI_BENCH) && !defined(QLCI_LIB)
 static const size_t DIMENSIONI_QLCI[] = {5, 7, 13, 19, 21, 29};
 static const size_t NUM_DIMENSIONI = sizeof(DIMENSIONI_QLCI) / sizeof(DIMENSIONI_QLCI[0]);
+#endif
 
-// Dichiarazione globale della matrice
-static size_t **matrice = NULL;
+/*
+** QLCI implicito: si memorizza la sola riga 0, poich ogni riga i  la
+** rotazione a sinistra di i posizioni della prima. Memoria O(n) anzich
+** O(n^2): per n = 10^6 bastano 8 MB invece di 8 TB.
+*/
+typedef struct {
+    size_t  n;
+    size_t *riga0;
+} QLCI_t;
 
 /********************************************************************************/
 /*
-** alloca_matrice()
+** crea_qlci()
 **
 ** Scopo:
-**   - Allocare dinamicamente una matrice quadrata di dimensione n x n.
-**   - Utilizza un'allocazione in blocco contiguo per efficienza e
-**     per semplificare la gestione della memoria.
+**   - Allocare la sola riga 0 di un QLCI di ordine n.
 **
 ** Parametri:
-**   - size_t n: La dimensione della matrice quadrata.
+**   - QLCI_t *q: Il QLCI implicito da inizializzare.
+**   - size_t n.: L'ordine del QLCI (deve essere dispari).
 **
 ** Valore restituito:
-**   - Nessuno. La funzione aggiorna la variabile globale 'matrice'.
-**
-** Errori:
-**   - In caso di errore di allocazione, stampa un messaggio e termina il programma.
+**   - bool: false in caso di errore di allocazione.
 */
 /********************************************************************************/
-void alloca_matrice(size_t n) {
-    // Allocazione dell'array di puntatori alle righe
-    matrice = (size_t **)malloc(n * sizeof(size_t *));
-    if (NULL == matrice) {
-        fprintf(stderr, "Errore: impossibile allocare memoria per l'array di puntatori.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    // Allocazione del blocco contiguo per tutti gli elementi
-    size_t *dati = (size_t *)malloc(n * n * sizeof(size_t));
-    if (NULL == dati) {
-        fprintf(stderr, "Errore: impossibile allocare memoria per il blocco di dati.\n");
-        free(matrice); // Libera il primo blocco allocato
-        exit(EXIT_FAILURE);
+bool crea_qlci(QLCI_t *q, size_t n) {
+    q->n = n;
+    q->riga0 = (size_t *)malloc(n * sizeof(size_t));
+    if (NULL == q->riga0) {
+        fprintf(stderr, "Errore: impossibile allocare memoria per la riga 0.\n");
+        return false;
     }
+    return true;
+}
 
-    // Collegamento delle righe al blocco contiguo
-    for (size_t i = 0; i < n; i++) {
-        matrice[i] = dati + i * n;
-    }
+/********************************************************************************/
+/*
+** libera_qlci()
+**
+** Scopo:
+**   - Deallocare la memoria utilizzata dal QLCI implicito.
+**
+** Note:
+**   - La funzione gestisce il caso in cui la riga sia gi NULL.
+*/
+/********************************************************************************/
+void libera_qlci(QLCI_t *q) {
+    free(q->riga0);
+    q->riga0 = NULL;  // Evita double free in esecuzioni successive
 }
 
 /********************************************************************************/
 /*
-** libera_matrice()
+** genera_qlci()
 **
 ** Scopo:
-**   - Deallocare la memoria utilizzata dalla matrice.
-**   - Funzione ideale per l'uso con atexit() per garantire la pulizia
-**     delle risorse in caso di uscita anticipata.
+**   - Generare un Quadrato Latino Commutativo Idempotente (QLCI) di ordine n.
+**   - Utilizza una tecnica di generazione basata su pattern rotazionali.
 **
 ** Parametri:
-**   - Nessuno. La funzione opera sulla variabile globale 'matrice'.
+**   - QLCI_t *q: Il QLCI implicito, gi allocato con crea_qlci().
 **
 ** Valore restituito:
-**   - Nessuno.
+**   - Nessuno. La funzione popola la riga 0.
 **
-** Note:
-**   - La funzione gestisce il caso in cui la matrice sia gi NULL.
+** Algoritmo:
+**   - Popola la prima riga con un pattern specifico "a pettine".
+**   - Le righe successive sono rotazioni cicliche a sinistra della prima,
+**     calcolate all'accesso da cella_qlci() e riga_qlci().
+**   - Questo garantisce le propriet di commutativit e idempotenza.
 */
 /********************************************************************************/
-void libera_matrice(void) {
-    if (NULL != matrice) {
-        free(matrice[0]); // Dealloca il blocco contiguo
-        free(matrice);    // Dealloca l'array di puntatori
-        matrice = NULL;   // Evita double free in esecuzioni successive
+void genera_qlci(QLCI_t *q) {
+    // Calcolo dell'offset per le due serie "a pettine"
+    // n  garantito dispari, quindi (n+1)  sempre pari e la divisione  esatta
+    size_t meta_n = (q->n + 1) >> 1;
+
+    for (size_t i = 0; i < q->n; i++) {
+        // Utilizza shift e mascheramento bit per massima efficienza
+        q->riga0[i] = (i >> 1) + 1 + ((i & 1) * meta_n);
     }
 }
 
 /********************************************************************************/
 /*
-** stampa_matrice()
+** cella_qlci()
 **
 ** Scopo:
-**   - Visualizzare la matrice quadrata su stdout.
-**   - Formatta l'output per una migliore leggibilit.
+**   - Restituire L[i][j] = riga0[(i + j) mod n] in tempo O(1).
 **
-** Parametri:
-**   - size_t n: La dimensione della matrice quadrata.
+** Note:
+**   - Con i, j < n si ha i + j < 2n: il modulo si riduce a un confronto.
+*/
+/********************************************************************************/
+size_t cella_qlci(const QLCI_t *q, size_t i, size_t j) {
+    size_t k = i + j;
+    return q->riga0[(k >= q->n) ? k - q->n : k];
+}
+
+/********************************************************************************/
+/*
+** riga_qlci()
 **
-** Valore restituito:
-**   - Nessuno.
+** Scopo:
+**   - Materializzare la riga i nel buffer del chiamante.
+**   - La rotazione si riduce a due memcpy() contigue, vettorizzate dalla
+**     libreria standard (SSE/AVX): nessun modulo per elemento.
+**
+** Parametri:
+**   - const QLCI_t *q: Il QLCI implicito.
+**   - size_t i.......: Indice di riga, 0 <= i < n.
+**   - size_t *dest...: Buffer di n elementi, a carico del chiamante.
 */
 /********************************************************************************/
-void stampa_matrice(size_t n) {
-    for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-            printf("%2zu ", matrice[i][j]);
-        }
-        printf("\n");
-    }
+void riga_qlci(const QLCI_t *q, size_t i, size_t *dest) {
+    memcpy(dest, q->riga0 + i, (q->n - i) * sizeof(size_t));
+    memcpy(dest + (q->n - i), q->riga0, i * sizeof(size_t));
 }
 
 /********************************************************************************/
 /*
-** genera_qlci()
+** stampa_qlci()
 **
 ** Scopo:
-**   - Generare un Quadrato Latino Commutativo Idempotente (QLCI) di ordine n.
-**   - Utilizza una tecnica di generazione basata su pattern rotazionali.
+**   - Visualizzare la matrice quadrata su stdout, una riga alla volta.
+**   - Formatta l'output per una migliore leggibilit.
 **
 ** Parametri:
-**   - size_t n: L'ordine del QLCI da generare (deve essere dispari).
+**   - const QLCI_t *q: Il QLCI implicito.
 **
 ** Valore restituito:
-**   - Nessuno. La funzione popola la matrice globale.
-**
-** Algoritmo:
-**   - Popola la prima riga con un pattern specifico "a pettine".
-**   - Genera le righe successive mediante rotazione ciclica a sinistra.
-**   - Questo garantisce le propriet di commutativit e idempotenza.
+**   - Nessuno.
 */
 /********************************************************************************/
-void genera_qlci(size_t n) {
-    // Calcolo dell'offset per le due serie "a pettine"
-    // n  garantito dispari, quindi (n+1)  sempre pari e la divisione  esatta
-    size_t meta_n = (n + 1) >> 1;  
+void stampa_qlci(const QLCI_t *q) {
+    size_t *riga = (size_t *)malloc(q->n * sizeof(size_t));
+    if (NULL == riga) {
+        fprintf(stderr, "Errore: impossibile allocare memoria per il buffer di riga.\n");
+        return;
+    }
+    for (size_t i = 0; i < q->n; i++) {
+        riga_qlci(q, i, riga);
+        for (size_t j = 0; j < q->n; j++) {
+            printf("%2zu ", riga[j]);
+        }
+        printf("\n");
+    }
+    free(riga);
+}
 
-    // Popola la prima riga
-    for (size_t i = 0; i < n; i++) {
-        // Utilizza shift e mascheramento bit per massima efficienza
-        matrice[0][i] = (i >> 1) + 1 + ((i & 1) * meta_n);
+#if defined(QLCI_BENCH)
+#include <time.h>
+
+/*
+** Benchmark per n = 10^6: materializzazione di 1000 righe con memcpy()
+** contro il ciclo originale con un modulo per elemento, piu' verifica che
+** ogni riga materializzata sia una permutazione di 1..n.
+*/
+int main(void) {
+    const size_t n = 1000001, R = 1000;
+    size_t *riga = (size_t *)malloc(n * sizeof(size_t));
+    unsigned char *visto = (unsigned char *)malloc(n + 1);
+    size_t chk1 = 0, chk2 = 0;
+    bool ok = true;
+    clock_t t0;
+    double t_mod, t_rot;
+    QLCI_t q;
+
+    if ((NULL == riga) || (NULL == visto) || !crea_qlci(&q, n)) {
+        fprintf(stderr, "Errore: impossibile allocare memoria.\n");
+        return EXIT_FAILURE;
     }
+    genera_qlci(&q);
 
-    // Popola le righe successive mediante rotazione di una 
-    // posizione a sinistra per ogni riga
-    for (size_t i = 1; i < n; i++) {
+    t0 = clock();
+    for (size_t r = 0; r < R; r++) {
+        size_t i = (r * 7919) % n;
         for (size_t j = 0; j < n; j++) {
-            matrice[i][j] = matrice[0][(j + i) % n];
+            riga[j] = q.riga0[(j + i) % n];
         }
+        chk1 += riga[r];
     }
-}
+    t_mod = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    for (size_t r = 0; r < R; r++) {
+        riga_qlci(&q, (r * 7919) % n, riga);
+        chk2 += riga[r];
+    }
+    t_rot = (double)(clock() - t0) / CLOCKS_PER_SEC;
 
+    for (size_t r = 0; ok && (r < 10); r++) {
+        size_t i = (r * 104729) % n;
+        riga_qlci(&q, i, riga);
+        memset(visto, 0, n + 1);
+        for (size_t j = 0; ok && (j < n); j++) {
+            ok = (riga[j] >= 1) && (riga[j] <= n) && !visto[riga[j]] &&
+                 (riga[j] == cella_qlci(&q, j, i));
+            visto[riga[j]] = 1;
+        }
+        ok = ok && (riga[i] == i + 1);
+    }
+
+    printf("QLCI implicito di ordine %zu: %.1f MB invece di %.1f GB\n", n,
+           n * sizeof(size_t) / 1048576.0, (double)n * n * sizeof(size_t) / 1073741824.0);
+    printf("%zu righe con modulo.....: %.3f s\n", R, t_mod);
+    printf("%zu righe con memcpy()...: %.3f s (%.1fx)\n", R, t_rot, t_mod / (t_rot > 0 ? t_rot : 1e-9));
+    printf("Checksum %s, verifica righe %s\n", (chk1 == chk2) ? "OK" : "ERRATO", ok ? "OK" : "ERRATA");
+
+    libera_qlci(&q);
+    free(riga);
+    free(visto);
+    return (ok && (chk1 == chk2)) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#elif !defined(QLCI_LIB)
 /********************************************************************************/
 /*
 ** main()
@@ -212,21 +300,25 @@ int main(void) {
             continue;  // Salta questa iterazione
         }
         
-        // Allocazione della matrice
-        alloca_matrice(n);
+        // Allocazione della sola riga 0
+        QLCI_t q;
+        if (!crea_qlci(&q, n)) {
+            return EXIT_FAILURE;
+        }
         
         // Generazione del QLCI
-        genera_qlci(n);
+        genera_qlci(&q);
         
         // Visualizzazione del risultato
         printf("QLCI di ordine %zu:\n", n);
-        stampa_matrice(n);
+        stampa_qlci(&q);
         printf("\n");
         
         // Deallocazione dopo ogni generazione
-        libera_matrice();
+        libera_qlci(&q);
     }
     
     return EXIT_SUCCESS;
 }
+#endif
 /** EOF: QLCI.c **/
\ No newline at end of file
@@ -0,0 +1,440 @@
+/************************************************************************/
+/* Libreria per la generazione di sistemi quadrupli di Steiner SQS(v),
+** costruiti a partire dai sistemi tripli ciclici di STSC.lib.
+**
+** Costruzioni implementate:
+**   - Estensione 1-rotazionale: SQS(v+1) sui punti Z_v + {oo}, con le
+**     quaterne T + {oo} per ogni terna T dello STS(v) ciclico generato
+**     da Genera_STSC() e le orbite modulo v di poche quaterne base
+**     tabulate in SQS_seed.h.
+**   - Raddoppio: da SQS(v) si ottiene SQS(2v) sui punti X x {0,1}:
+**     ogni quaterna {a,b,c,d} genera le 8 quaterne {(a,i),(b,j),(c,k),
+**     (d,l)} con i+j+k+l pari, e ogni coppia {x,y} di X genera la
+**     quaterna {(x,0),(y,0),(x,1),(y,1)}.
+**   - Triplicazione di Hanani, SQS(v) -> SQS(3v-2): fissato oo = v-1 e
+**     Y = {0..v-2}, i punti sono oo + Z_3 x Y. Ogni quaterna {oo,a,b,c}
+**     genera le 27 quaterne di SQS_T10 (SQS(10) privato delle verticali)
+**     sui punti oo + Z_3 x {a,b,c}; ogni quaterna {a,b,c,d} senza oo
+**     genera le 27 quaterne {(i,a),(j,b),(k,c),(l,d)} con i+j+k+l = 0
+**     (mod 3); infine ogni y di Y da' la verticale {oo,(0,y),(1,y),(2,y)}.
+**
+** Le altre costruzioni di Hanani (3v-8, 4v-6, 12v-10) non sono
+** implementate: SQS_costruibile() restituisce false per gli ordini che ne
+** richiederebbero una, a partire da 34, 38, 50, 62, 68, 70, 74.
+**
+** Riferimenti:
+** Haim Hanani, 1960.
+** "On quadruple systems".
+** Canadian Journal of Mathematics, Vol. 12, pp. 145-157.
+** DOI: 10.4153/CJM-1960-013-3
+**
+** Charles C. Lindner, Alexander Rosa, 1978.
+** "Steiner quadruple systems - a survey".
+** Discrete Mathematics, Vol. 22, Issue 2, pp. 147-181.
+** DOI: 10.1016/0012-365X(78)90124-9
+**
+** Il numero di quaterne cresce come v^3, pertanto i sistemi vengono
+** emessi in streaming attraverso un sink, senza mai memorizzarli.
+**
+** Compilare come eseguibile abilitando il simbolo SQS_TEST per un test
+** run automatico, oppure SQS_BENCH per il benchmark di throughput.
+**
+** Funzioni esportate:
+**   bool Convalida_SQS(size_t v);
+**   size_t Totale_quaterne_SQS(size_t v);
+**   bool SQS_costruibile(size_t v);
+**   size_t Genera_SQS(size_t v, SQS_sink_t sink, void* ctx);
+**   bool SQS_verifica_init(SQS_verifica_t* vf, size_t v);
+**   bool SQS_verifica_sink(const Quaterna_t* q, void* ctx);
+**   bool SQS_verifica_esito(const SQS_verifica_t* vf);
+**   void SQS_verifica_libera(SQS_verifica_t* vf);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SQS.h"
+#include "SQS_seed.h"
+
+// Stato di un livello di raddoppio: inoltra al sink esterno
+typedef struct {
+    uint32_t   h;           // Ordine del SQS interno (meta')
+    SQS_sink_t sink;
+    void*      ctx;
+} Raddoppio_t;
+
+// Stato di un livello di triplicazione: il punto (i,y) vale i * w + y
+typedef struct {
+    uint32_t   w;           // |Y| = ordine del SQS interno meno uno
+    SQS_sink_t sink;
+    void*      ctx;
+} Triplicazione_t;
+
+// Contatore delle quaterne emesse, interposto al sink dell'utente
+typedef struct {
+    SQS_sink_t sink;
+    void*      ctx;
+    size_t     tot;
+    bool       fermato;     // il sink dell'utente ha interrotto
+} Conteggio_t;
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+static const SQS_seme_t* cerca_seme(size_t v) {
+    for (size_t i = 0; i < MAX_SEMI; ++i) {
+        if (SQS_SEMI[i].v == v) {
+            return &SQS_SEMI[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+** Emette il SQS tabulato in un seme: prima le terne dello STS ciclico
+** estese con il punto all'infinito, poi le quaterne tabulate, sviluppate
+** modulo v_sts se il seme e' 1-rotazionale.
+*/
+static bool genera_seme(const SQS_seme_t* s, SQS_sink_t sink, void* ctx) {
+    const uint32_t n = s->v_sts;
+
+    if (0 != n) {
+        size_t b = Totale_terne_STS(n);
+        Terna_t* STS = (Terna_t*)malloc(b * sizeof(Terna_t));
+        bool ok;
+
+        if (NULL == STS) {
+            fputs(">> LIB_SQS.Genera_SQS(): ERRORE\n"
+                  ">>    Allocazione dello STS del seme fallita.\n\n", stderr);
+            return false;
+        }
+        ok = (Genera_STSC(n, STS) == b);
+        for (size_t i = 0; ok && (i < b); ++i) {
+            Quaterna_t q = {STS[i].a, STS[i].b, STS[i].c, n};
+            ok = sink(&q, ctx);
+        }
+        free(STS);
+        if (!ok) {
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < s->nq; ++i) {
+        Quaterna_t q = s->q[i];
+        if (!s->sviluppo) {
+            if (!sink(&q, ctx)) {
+                return false;
+            }
+            continue;
+        }
+        // Sviluppo ciclico, con riduzione modulare per confronto
+        for (uint32_t j = 0; j < n; ++j) {
+            if (!sink(&q, ctx)) {
+                return false;
+            }
+            if (++q.a == n) q.a = 0;
+            if (++q.b == n) q.b = 0;
+            if (++q.c == n) q.c = 0;
+            if (++q.d == n) q.d = 0;
+        }
+    }
+    return true;
+}
+
+/*
+** Sink intermedio del raddoppio: per ogni quaterna del SQS(h) interno
+** emette le 8 quaterne con somma pari dei livelli.
+*/
+static bool raddoppio_sink(const Quaterna_t* q, void* ctx) {
+    const Raddoppio_t* r = (const Raddoppio_t*)ctx;
+    const uint32_t h = r->h;
+
+    for (uint32_t m = 0; m < 8; ++m) {
+        uint32_t l = ((m >> 2) ^ (m >> 1) ^ m) & 1;
+        Quaterna_t p = {q->a + (m & 1) * h,
+                        q->b + ((m >> 1) & 1) * h,
+                        q->c + ((m >> 2) & 1) * h,
+                        q->d + l * h};
+        if (!r->sink(&p, r->ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+** Sink intermedio della triplicazione: le quaterne con oo = w vengono
+** sostituite dalle 27 di SQS_T10, le altre dalle 27 con somma nulla
+** dei livelli modulo 3.
+*/
+static bool triplicazione_sink(const Quaterna_t* q, void* ctx) {
+    const Triplicazione_t* t = (const Triplicazione_t*)ctx;
+    const uint32_t w = t->w;
+    uint32_t p[4] = {q->a, q->b, q->c, q->d};
+
+    if ((w == p[0]) || (w == p[1]) || (w == p[2]) || (w == p[3])) {
+        uint32_t y[3], n = 0;
+        uint32_t m[10];
+
+        for (uint32_t i = 0; i < 4; ++i) {
+            if (w != p[i]) {
+                y[n++] = p[i];
+            }
+        }
+        // Tabella di conversione etichetta -> punto del SQS(3w+1)
+        m[0] = 3 * w;
+        for (uint32_t e = 1; e < 10; ++e) {
+            m[e] = ((e - 1) % 3) * w + y[(e - 1) / 3];
+        }
+        for (size_t i = 0; i < MAX_T10; ++i) {
+            Quaterna_t r = {m[SQS_T10[i].a], m[SQS_T10[i].b],
+                            m[SQS_T10[i].c], m[SQS_T10[i].d]};
+            if (!t->sink(&r, t->ctx)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        for (uint32_t j = 0; j < 3; ++j) {
+            for (uint32_t k = 0; k < 3; ++k) {
+                uint32_t l = (9 - i - j - k) % 3;
+                Quaterna_t r = {p[0] + i * w, p[1] + j * w, p[2] + k * w, p[3] + l * w};
+                if (!t->sink(&r, t->ctx)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Ordine raggiungibile per raddoppio di un SQS costruibile
+static bool via_raddoppio(size_t v) {
+    return (0 == (v & 1)) && SQS_costruibile(v / 2);
+}
+
+// Ordine raggiungibile per triplicazione 3u - 2 di un SQS costruibile
+static bool via_triplicazione(size_t v) {
+    return (0 == (v + 2) % 3) && SQS_costruibile((v + 2) / 3);
+}
+
+static bool genera_rec(size_t v, SQS_sink_t sink, void* ctx) {
+    const SQS_seme_t* s = cerca_seme(v);
+    Raddoppio_t r;
+
+    if (NULL != s) {
+        return genera_seme(s, sink, ctx);
+    }
+
+    if (!via_raddoppio(v)) {
+        // Triplicazione: quaterne derivate dal SQS((v+2)/3), poi le verticali
+        Triplicazione_t t;
+        t.w    = (uint32_t)((v + 2) / 3 - 1);
+        t.sink = sink;
+        t.ctx  = ctx;
+        if (!genera_rec(t.w + 1, triplicazione_sink, &t)) {
+            return false;
+        }
+        for (uint32_t y = 0; y < t.w; ++y) {
+            Quaterna_t q = {3 * t.w, y, y + t.w, y + 2 * t.w};
+            if (!sink(&q, ctx)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Raddoppio: prima le quaterne derivate dal SQS(v/2), poi le coppie
+    r.h    = (uint32_t)(v / 2);
+    r.sink = sink;
+    r.ctx  = ctx;
+    if (!genera_rec(r.h, raddoppio_sink, &r)) {
+        return false;
+    }
+    for (uint32_t x = 0; x < r.h; ++x) {
+        for (uint32_t y = x + 1; y < r.h; ++y) {
+            Quaterna_t q = {x, y, x + r.h, y + r.h};
+            if (!sink(&q, ctx)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool conteggio_sink(const Quaterna_t* q, void* ctx) {
+    Conteggio_t* c = (Conteggio_t*)ctx;
+    c->tot += 1;
+    c->fermato = !c->sink(q, c->ctx);
+    return !c->fermato;
+}
+
+// Indice colex della terna a < b < c: C(c,3) + C(b,2) + a
+static size_t indice_terna(size_t a, size_t b, size_t c) {
+    return c * (c - 1) * (c - 2) / 6 + b * (b - 1) / 2 + a;
+}
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+bool Convalida_SQS(size_t v) {
+    return (v >= 4) && ((v % 6 == 2) || (v % 6 == 4));
+}
+
+size_t Totale_quaterne_SQS(size_t v) {
+    return v * (v - 1U) * (v - 2U) / 24U;
+}
+
+bool SQS_costruibile(size_t v) {
+    if (!Convalida_SQS(v)) {
+        return false;
+    }
+    if (NULL != cerca_seme(v)) {
+        return true;
+    }
+    return via_raddoppio(v) || via_triplicazione(v);
+}
+
+size_t Genera_SQS(size_t v, SQS_sink_t sink, void* ctx) {
+    Conteggio_t c = {sink, ctx, 0U, false};
+
+    if (!Convalida_SQS(v)) {
+        fprintf(stderr, ">> LIB_SQS.Genera_SQS(): ERRORE\n"
+                ">>    Controllo di congruenza fallito per v = %zu\n\n", v);
+        return 0U;
+    }
+
+    if (!SQS_costruibile(v) || (v > UINT32_MAX)) {
+        fprintf(stderr, ">> LIB_SQS.Genera_SQS(): ERRORE\n"
+                ">>    Nessuna costruzione disponibile per v = %zu\n\n", v);
+        return 0U;
+    }
+
+    if (NULL == sink) {
+        fprintf(stderr, ">> LIB_SQS.Genera_SQS(): ERRORE\n"
+                ">>    Il sink delle quaterne e' obbligatorio.\n\n");
+        return 0U;
+    }
+
+    // Un'interruzione del sink non e' un errore: restituisce le quaterne emesse
+    if (!genera_rec(v, conteggio_sink, &c) && !c.fermato) {
+        fprintf(stderr, ">> LIB_SQS.Genera_SQS(): ERRORE\n"
+                ">>    Costruzione di SQS(%zu) fallita.\n\n", v);
+        return 0U;
+    }
+    return c.tot;
+}
+
+bool SQS_verifica_init(SQS_verifica_t* vf, size_t v) {
+    size_t bit = indice_terna(0, 1, v);     // C(v,3)
+    vf->v = v;
+    vf->quaterne = 0;
+    vf->errori = 0;
+    vf->bitmap = (uint64_t*)calloc(bit / 64 + 1, sizeof(uint64_t));
+    return NULL != vf->bitmap;
+}
+
+bool SQS_verifica_sink(const Quaterna_t* q, void* ctx) {
+    SQS_verifica_t* vf = (SQS_verifica_t*)ctx;
+    uint32_t p[4] = {q->a, q->b, q->c, q->d};
+
+    vf->quaterne += 1;
+
+    // Ordinamento a rete per quattro elementi
+    #define SCAMBIA(i, j) if (p[i] > p[j]) { uint32_t t = p[i]; p[i] = p[j]; p[j] = t; }
+    SCAMBIA(0, 1) SCAMBIA(2, 3) SCAMBIA(0, 2) SCAMBIA(1, 3) SCAMBIA(1, 2)
+    #undef SCAMBIA
+
+    if ((p[3] >= vf->v) || (p[0] == p[1]) || (p[1] == p[2]) || (p[2] == p[3])) {
+        vf->errori += 1;
+        return true;
+    }
+
+    // Le quattro terne contenute nella quaterna
+    size_t t[4] = {indice_terna(p[0], p[1], p[2]), indice_terna(p[0], p[1], p[3]),
+                   indice_terna(p[0], p[2], p[3]), indice_terna(p[1], p[2], p[3])};
+    for (size_t i = 0; i < 4; ++i) {
+        uint64_t m = 1ULL << (t[i] & 63);
+        if (vf->bitmap[t[i] >> 6] & m) {
+            vf->errori += 1;
+        }
+        vf->bitmap[t[i] >> 6] |= m;
+    }
+    return true;
+}
+
+// Nessuna terna ripetuta e b quaterne: allora tutte le C(v,3) terne sono coperte
+bool SQS_verifica_esito(const SQS_verifica_t* vf) {
+    return (0 == vf->errori) && (Totale_quaterne_SQS(vf->v) == vf->quaterne);
+}
+
+void SQS_verifica_libera(SQS_verifica_t* vf) {
+    free(vf->bitmap);
+    vf->bitmap = NULL;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(SQS_TEST)
+/*
+** Self-test: verifica a bitset di tutti gli SQS costruibili fino a v = 256.
+*/
+int main() {
+    size_t fallimenti = 0;
+
+    for (size_t v = 4; v <= 256; ++v) {
+        SQS_verifica_t vf;
+        size_t tot;
+
+        if (!SQS_costruibile(v)) {
+            continue;
+        }
+        if (!SQS_verifica_init(&vf, v)) {
+            fputs("Errore di allocazione!\n", stderr);
+            return EXIT_FAILURE;
+        }
+        tot = Genera_SQS(v, SQS_verifica_sink, &vf);
+        printf("** SQS(%3zu): %8zu quaterne, %s\n", v, tot,
+               SQS_verifica_esito(&vf) ? "verificato" : "ERRATO");
+        fallimenti += !SQS_verifica_esito(&vf);
+        SQS_verifica_libera(&vf);
+    }
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#elif defined(SQS_BENCH)
+#include <time.h>
+
+// Sink minimo: impedisce al compilatore di eliminare il lavoro
+static bool checksum_sink(const Quaterna_t* q, void* ctx) {
+    *(uint64_t*)ctx += q->a ^ q->b ^ q->c ^ q->d;
+    return true;
+}
+
+/*
+** Benchmark di throughput della generazione in streaming.
+*/
+int main() {
+    const size_t ordini[] = {32, 64, 128, 256, 512, 1024, 2048};
+
+    printf("%6s %14s %10s %14s\n", "v", "quaterne", "secondi", "quaterne/s");
+    for (size_t i = 0; i < sizeof(ordini) / sizeof(ordini[0]); ++i) {
+        uint64_t chk = 0;
+        clock_t t0 = clock();
+        size_t tot = Genera_SQS(ordini[i], checksum_sink, &chk);
+        double sec = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("%6zu %14zu %10.3f %14.0f (chk %llx)\n", ordini[i], tot, sec,
+               (sec > 0.0) ? (double)tot / sec : 0.0, (unsigned long long)chk);
+    }
+    return EXIT_SUCCESS;
+}
+#endif
+/** EOF: SQS.c **/
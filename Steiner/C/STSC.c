@@ -18,11 +18,16 @@
 ** e modulari.
 **
 ** Compilare come eseguibile abilitando il simbolo LIB_TEST per un test 
-** run automatico in modalita' standalone.
+** run automatico in modalita' standalone, oppure STSC_BENCH (con OpenMP)
+** per i tempi di Genera_STSC_parallel() su ordini v >= 10^4.
 **
 ** Funzioni esportate:
 **   size_t Genera_STSC(size_t v, Terna_t* STSC, Terna_t* TDiff, size_t td);
+**   size_t Genera_STSC_parallel(size_t v, Terna_t* STSC);
+**   size_t Genera_STSC_da_terne(size_t v, const Terna_t* TDiff, size_t td,
+**                               Terna_t* STSC);
 **   Terna_t* Genera_terne_differenza(size_t v, size_t* td);
+**   const Terna_t* STSC_precalcolato(size_t v, size_t* b);
 **   bool Convalida_v(size_t v);
 **   size_t Totale_terne_STS(size_t v);
 **
@@ -35,12 +40,25 @@
 #include <stdlib.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include <string.h>
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
 #include "stsc.h"
 #include "Peltesohn.h"
+#ifndef STSC_NO_PICCOLI
+ #include "STSC_piccoli.h"
+ #if STSC_PICCOLI_VERSION != STSC_LIB_VERSION
+  #error "STSC_piccoli.h obsoleto: rigenerarlo con gen_piccoli.c"
+ #endif
+#endif
 
 // Dimensionamento volutamente esorbitante per un esempio didattico
 #define MAX_TERNE 10000
 
+// Soglia minima (in terne) sotto la quale non conviene attivare i thread
+#define SOGLIA_PARALLELO 65536U
+
 // String-ification per i messaggi d'errore
 #define TO_STRING(x) #x
 
@@ -184,6 +202,94 @@ static void genera_parametriche(void) {
     }
 }
 
+/********************************************************************************/
+/*
+** Sviluppa le orbite nell'intervallo [lo, hi) dell'array di output.
+** Le terne sono numerate come in Genera_STSC(): l'orbita i occupa il range
+** [i*v, (i+1)*v), seguita dalla eventuale short orbit per v = 6n + 3.
+** L'intervallo puo' iniziare e terminare a meta' di un'orbita, quindi i
+** thread ricevono porzioni equilibrate anche quando td e' piccolo.
+** Una sola divisione per segmento: all'interno dell'orbita il modulo e'
+** sostituito da un confronto, dato che ogni componente cresce di 1.
+*/
+/********************************************************************************/
+static void sviluppa_intervallo(size_t v, const Terna_t* TDiff, size_t td,
+                                size_t lo, size_t hi, Terna_t* STSC) {
+    const size_t lunghe = td * v;   // Terne delle orbite complete
+    size_t i = lo;
+
+    while (i < hi) {
+        uint32_t j, x1, x2, fine;
+        size_t b1, b2, len;
+
+        if (i < lunghe) {
+            size_t o = i / v;
+            j  = (uint32_t)(i - o * v);
+            b1 = TDiff[o].a;
+            b2 = (size_t)TDiff[o].a + TDiff[o].b;
+            len = v;
+        } else {
+            // Short orbit, solo se v = 6n + 3: (0, 2n+1, 4n+2)
+            size_t n = (v - 3) / 6;
+            j  = (uint32_t)(i - lunghe);
+            b1 = 2 * n + 1;
+            b2 = 4 * n + 2;
+            len = 2 * n + 1;
+        }
+
+        x1 = (uint32_t)((b1 + j) % v);
+        x2 = (uint32_t)((b2 + j) % v);
+        fine = (uint32_t)(((hi - i) < (len - j)) ? j + (hi - i) : len);
+
+        for (; j < fine; ++j, ++i) {
+            STSC[i] = (Terna_t) {j, x1, x2};
+            if (++x1 == v) x1 = 0;
+            if (++x2 == v) x2 = 0;
+        }
+    }
+}
+
+/********************************************************************************/
+/*
+** Sviluppo ciclico delle terne differenza, comune a Genera_STSC() e a
+** Genera_STSC_da_terne().
+*/
+/********************************************************************************/
+static size_t sviluppa_terne(size_t v, const Terna_t* TDiff, size_t td, Terna_t* STSC) {
+    size_t tc = 0U;         // Contatore locale terne
+
+    // Prima fase: terne di base e generazione parametrica
+    for (uint32_t i = 0; i < td; ++i) {
+        uint32_t b2;
+
+        // Ricavo la terna base dalla corrispondente terna differenza
+        // b0 = 0, b1 = a, b2 = a + b
+        b2 = TDiff[i].a + TDiff[i].b;
+
+        // Ricavo le terne del blocco principale, valido per ambedue i casi
+        for (uint32_t j = 0; j < v; ++j) {
+            // Salvo la terna generata
+            STSC[tc++] = (Terna_t) {j, MOD(TDiff[i].a + j, v), MOD(b2 + j, v)};
+        }
+    }
+
+    // Seconda fase: short orbit, solo se v = 6n + 3
+    if (v % 6 == 3) {
+        uint32_t n = (v - 3) / 6;
+        uint32_t b1, b2;
+
+        // Valori della terna Short Orbit (b0 = 0)
+        b1 = 2 * n + 1;
+        b2 = 4 * n + 2;
+
+        for (uint32_t i = 0; i <= 2 * n; i++) {
+            STSC[tc++] = (Terna_t) {i, MOD(b1 + i, v), MOD(b2 + i, v)};
+        }
+    }
+
+    return tc;
+}
+
 /************************************************************/
 /*
 ** Convalida_v()
@@ -333,6 +439,14 @@ size_t Genera_STSC(size_t v, Terna_t *STSC) {
         return tc;
     }
 
+#ifndef STSC_NO_PICCOLI
+    // Piccoli ordini: copia diretta della tabella precalcolata
+    if (v <= STSC_PICCOLI_MAX) {
+        memcpy(STSC, STSC_PICCOLI[v].terne, STSC_PICCOLI[v].b * sizeof(Terna_t));
+        return STSC_PICCOLI[v].b;
+    }
+#endif
+
     // Genero dinamicamente le terne differenza
     TDiff = Genera_terne_differenza(v, &td);
     if (NULL == TDiff) {
@@ -341,34 +455,176 @@ size_t Genera_STSC(size_t v, Terna_t *STSC) {
         return tc;
     }
 
-    // Prima fase: terne di base e generazione parametrica
-    for (uint32_t i = 0; i < td; ++i) {
-        uint32_t b2;
+    return sviluppa_terne(v, TDiff, td, STSC);
+}
 
-        // Ricavo la terna base dalla corrispondente terna differenza
-        // b0 = 0, b1 = a, b2 = a + b
-        b2 = TDiff[i].a + TDiff[i].b;
+/********************************************************************************/
+/*
+** STSC_precalcolato()
+**
+** Scopo:
+**   - Percorso rapido per i piccoli ordini: restituisce il puntatore alla
+**     tabella costante dello STS gia' sviluppato, senza copie ne' calcoli.
+**     Nessun messaggio d'errore: il chiamante ripiega su Genera_STSC().
+**
+** Parametri:
+**   - size_t v.: La dimensione del STSC.
+**   - size_t* b: Numero di terne della tabella (0 se assente).
+**
+** Valore restituito:
+**   - const Terna_t*: la tabella, oppure NULL se v > STSC_PICCOLI_MAX o
+**                     non ammissibile.
+*/
+/********************************************************************************/
+const Terna_t* STSC_precalcolato(size_t v, size_t* b) {
+#ifndef STSC_NO_PICCOLI
+    if (v <= STSC_PICCOLI_MAX) {
+        *b = STSC_PICCOLI[v].b;
+        return STSC_PICCOLI[v].terne;
+    }
+#else
+    (void)v;
+#endif
+    *b = 0;
+    return NULL;
+}
 
-        // Ricavo le terne del blocco principale, valido per ambedue i casi
-        for (uint32_t j = 0; j < v; ++j) {
-            // Salvo la terna generata
-            STSC[tc++] = (Terna_t) {j, MOD(TDiff[i].a + j, v), MOD(b2 + j, v)};
-        }
+/********************************************************************************/
+/*
+** Genera_STSC_da_terne()
+**
+** Scopo:
+**   - Variante di Genera_STSC() che sviluppa un insieme di terne differenza
+**     fornito dal chiamante, ad esempio una delle soluzioni alternative
+**     trovate da Cerca_terne_differenza(), anziche' quello di Peltesohn.
+**   - Le terne vengono convalidate: devono essere (v-1)/6 oppure (v-3)/6,
+**     ciascuna con c = +/-(a + b) mod v, e le differenze a, b, a + b,
+**     ripiegate in 1..(v-1)/2, devono coprire esattamente una volta
+**     1..(v-1)/2 (escluso v/3 se v = 6n+3).
+**
+** Parametri:
+**   - Size_t   v..........: La dimensione del STSC, della forma 6n+1 oppure 6n+3.
+**   - const Terna_t* TDiff: Le terne differenza {a, b, c}, terna base {0, a, a+b}.
+**   - size_t td...........: Numero di terne differenza.
+**   - Terna_t* STSC.......: Puntatore all'array di terne, allocato a carico
+**                           del chiamante come per Genera_STSC().
+**
+** Valore restituito:
+**   - size_t: 0 in caso d'errore, oppure il numero di terne b del STSC(v).
+*/
+/********************************************************************************/
+size_t Genera_STSC_da_terne(size_t v, const Terna_t* TDiff, size_t td, Terna_t* STSC) {
+    uint8_t* usate;         // Differenze gia' coperte
+    bool     ok;
+
+    if (!Convalida_v(v) || (NULL == TDiff) || (NULL == STSC) ||
+        (td != (v - 1) / 6)) {
+        fprintf(stderr, ">> LIB_STS.Genera_STSC_da_terne(): ERRORE\n"
+                ">>    Parametri non validi per v = %zu, td = %zu\n\n", v, td);
+        return 0U;
     }
 
-    // Seconda fase: short orbit, solo se v = 6n + 3
+    usate = (uint8_t*)calloc(v / 2 + 1, sizeof(uint8_t));
+    if (NULL == usate) {
+        fputs("Errore di allocazione!\n", stderr);
+        return 0U;
+    }
     if (v % 6 == 3) {
-        uint32_t n = (v - 3) / 6;
-        uint32_t b1, b2;
+        usate[v / 3] = 1;
+    }
+    ok = true;
+    for (size_t i = 0; ok && (i < td); ++i) {
+        // Differenze della terna base {0, a, a+b}, ripiegate in 1..v/2:
+        // la c di Peltesohn puo' valere a + b anche oltre v/2
+        const size_t ab = (size_t)TDiff[i].a + TDiff[i].b;
+        const size_t d[3] = {TDiff[i].a, TDiff[i].b, (ab > v / 2) ? v - ab : ab};
+        const size_t c = (TDiff[i].c > v / 2) ? v - TDiff[i].c : TDiff[i].c;
+        ok = (ab < v) && (c == d[2]);
+        for (size_t h = 0; ok && (h < 3); ++h) {
+            ok = (d[h] > 0) && (d[h] <= v / 2) && !usate[d[h]];
+            if (ok) {
+                usate[d[h]] = 1;
+            }
+        }
+    }
+    free(usate);
+    if (!ok) {
+        fprintf(stderr, ">> LIB_STS.Genera_STSC_da_terne(): ERRORE\n"
+                ">>    Le terne non formano un insieme di terne differenza per v = %zu\n\n", v);
+        return 0U;
+    }
 
-        // Valori della terna Short Orbit (b0 = 0)
-        b1 = 2 * n + 1;
-        b2 = 4 * n + 2;
+    return sviluppa_terne(v, TDiff, td, STSC);
+}
 
-        for (uint32_t i = 0; i <= 2 * n; i++) {
-            STSC[tc++] = (Terna_t) {i, MOD(b1 + i, v), MOD(b2 + i, v)};
-        }
+/********************************************************************************/
+/*
+** Genera_STSC_parallel()
+**
+** Scopo:
+**   - Variante multithread di Genera_STSC(), con output identico.
+**     Le terne differenza vengono calcolate una sola volta dal thread
+**     chiamante, poi l'intero array di b terne viene suddiviso in
+**     intervalli contigui di uguale ampiezza, uno per thread: le orbite
+**     lunghe vengono quindi spezzate tra piu' thread quando necessario.
+**   - La partizione e' statica: ogni thread scrive sempre la stessa
+**     porzione dell'array. Se il chiamante alloca STSC con malloc() senza
+**     inizializzarlo (niente calloc() o memset()), il primo accesso a ogni
+**     pagina avviene dal thread che la scrive, e sui sistemi NUMA la pagina
+**     viene allocata sul nodo locale (first-touch).
+**   - Senza supporto OpenMP in compilazione, oppure per b inferiore a
+**     SOGLIA_PARALLELO, la generazione avviene nel solo thread chiamante.
+**
+** Parametri:
+**   - Size_t   v......: La dimensione del STSC, della forma 6n+1 oppure 6n+3.
+**   - Terna_t* STSC...: Puntatore all'array di terne, allocato a carico
+**                       del chiamante e dimensionato usando la funzione di 
+**                       libreria apposita totale_terne_STS(v).
+**
+** Valore restituito:
+**   - size_t: 0 in caso d'errore, oppure il numero di terne b del STSC(v).
+*/
+/********************************************************************************/
+size_t Genera_STSC_parallel(size_t v, Terna_t *STSC) {
+    size_t td = 0U;         // Contatore terne differenza
+    size_t tc;              // Totale terne da generare
+    Terna_t* TDiff;         // Array terne differenza  
+
+    // Programmazione difensiva
+    if (!Convalida_v(v)) {
+        fprintf(stderr, ">> LIB_STS.Genera_STSC_parallel(): ERRORE\n"
+                ">>    Controllo di congruenza fallito per v = %zu\n\n", v);
+        return 0U;
+    }
+
+    if (NULL == STSC) {
+        fprintf(stderr, ">> LIB_STS.Genera_STSC_parallel(): ERRORE\n"
+                ">>     L'array di terne del STS deve essere\n"
+                ">>     allocato dal chiamante.\n\n");
+        return 0U;
+    }
+
+    // Terne differenza: unica sezione seriale, l'array statico
+    // viene poi soltanto letto dai thread
+    TDiff = Genera_terne_differenza(v, &td);
+    if (NULL == TDiff) {
+        fprintf(stderr, ">> LIB_STS.Genera_STSC_parallel(): ERRORE\n"
+                ">>    Errore nella generazione delle terne differenza.\n\n");
+        return 0U;
+    }
+
+    tc = td * v + ((v % 6 == 3) ? v / 3 : 0U);
+
+#ifdef _OPENMP
+    #pragma omp parallel if (tc >= SOGLIA_PARALLELO)
+    {
+        size_t nt = (size_t)omp_get_num_threads();
+        size_t id = (size_t)omp_get_thread_num();
+        sviluppa_intervallo(v, TDiff, td, tc * id / nt, tc * (id + 1) / nt, STSC);
     }
+#else
+    sviluppa_intervallo(v, TDiff, td, 0U, tc, STSC);
+#endif
 
     return tc;
 }
@@ -426,5 +682,84 @@ int main() {
     
     return EXIT_SUCCESS;
 }
+#elif defined(STSC_BENCH)
+#include <stdint.h>
+#include <time.h>
+
+// Tempo di parete: clock() sommerebbe il tempo CPU di tutti i thread
+static double orologio(void) {
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+// Impronta FNV-1a delle terne, per confrontare le due generazioni
+static uint64_t impronta(const Terna_t* STS, size_t b) {
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < b; ++i) {
+        h = (h ^ STS[i].a) * 1099511628211ULL;
+        h = (h ^ STS[i].b) * 1099511628211ULL;
+        h = (h ^ STS[i].c) * 1099511628211ULL;
+    }
+    return h;
+}
+
+/*
+** Genera_STSC() contro Genera_STSC_parallel() su ordini v >= 10^4.
+** Ogni generazione scrive in un array appena allocato e mai toccato,
+** quindi entrambi i tempi comprendono i page fault del primo accesso,
+** che nella variante parallela sono distribuiti tra i thread.
+** Il numero di thread si imposta con OMP_NUM_THREADS.
+*/
+int main() {
+    const size_t ordini[] = {10003, 15003, 20011, 25003, 30007};
+    size_t fallimenti = 0;
+    int    nt = 1;
+
+#ifdef _OPENMP
+    nt = omp_get_max_threads();
+#endif
+    printf("Genera_STSC_parallel(), %d thread, tempi di parete in secondi\n", nt);
+    printf("%8s %12s %10s %10s %8s %14s\n",
+           "v", "terne", "seriale", "parallelo", "x", "terne/s");
+    for (size_t i = 0; i < sizeof(ordini) / sizeof(ordini[0]); ++i) {
+        size_t   v = ordini[i];
+        size_t   b = Totale_terne_STS(v);
+        Terna_t* STS;
+        double   t0, ts = 0.0, tp = 0.0;
+        uint64_t hs = 0, hp = 0;
+        bool     ok;
+
+        STS = (Terna_t*)malloc(b * sizeof(Terna_t));
+        ok = (NULL != STS);
+        if (ok) {
+            t0 = orologio();
+            ok = (Genera_STSC(v, STS) == b);
+            ts = orologio() - t0;
+            hs = impronta(STS, b);
+            free(STS);
+        }
+        STS = ok ? (Terna_t*)malloc(b * sizeof(Terna_t)) : NULL;
+        ok = ok && (NULL != STS);
+        if (ok) {
+            t0 = orologio();
+            ok = (Genera_STSC_parallel(v, STS) == b);
+            tp = orologio() - t0;
+            hp = impronta(STS, b);
+            free(STS);
+        }
+        if (!ok || (hs != hp)) {
+            printf("%8zu %12zu ERRATO\n", v, b);
+            ++fallimenti;
+            continue;
+        }
+        printf("%8zu %12zu %10.3f %10.3f %8.2f %14.0f\n", v, b, ts, tp,
+               (tp > 0.0) ? ts / tp : 0.0, (tp > 0.0) ? (double)b / tp : 0.0);
+    }
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
 #endif
 /** EOF: STSC.c **/
\ No newline at end of file
@@ -156,12 +156,16 @@ bool prompt_user(void) {
 
 void usage(char *fn) {
  
-    fprintf(stderr, "Uso: %s [/help | /test | /interactive | /batch <min> <max>]\n"
+    fprintf(stderr, "Uso: %s [/nocache] [/help | /test | /interactive | /batch <min> <max>]\n"
+        "  /nocache           : Disabilita la cache persistente su disco.\n"
         "  /help              : Mostra la presente schermata.\n"
-        "  /test              : Esegue i test automatici.\n"
+        "  /test              : Esegue i test automatici, senza usare la cache.\n"
         "  /interactive       : Genera STS interattivamente.\n"
         "  /batch <min> <max> : Genera STS per l'intervallo specificato,\n"
         "                       usando solo valori validi per v della forma\n"
-        "                       6n+1 oppure 6n+3, compresi tra %u e %u.\n\n", fn, MIN_V, MAX_V);
+        "                       6n+1 oppure 6n+3, compresi tra %u e %u.\n\n"
+        "Gli STS generati vengono memorizzati nella cache su disco \"%s\"\n"
+        "(variabile d'ambiente STSC_CACHE_DIR), limitata a %u MB con politica\n"
+        "LRU (variabile d'ambiente STSC_CACHE_MB).\n\n", fn, MIN_V, MAX_V, CACHE_DIR, CACHE_MAX_MB);
 }
 /** EOF: STSC_UI.c **/
\ No newline at end of file
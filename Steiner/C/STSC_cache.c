@@ -0,0 +1,432 @@
+/********************************************************************************/
+/*
+** Progetto: STSC_gen.exe
+**
+** Scopo: generazione di STS ciclici (STSC) con metodo Heffter-Peltesohn
+**        tramite la libreria STSC.lib.
+**
+** Nome del modulo: STSC_cache.c
+** Scopo:
+**   - Implementa una cache persistente su disco degli STS(v) generati.
+**   - Le voci sono indirizzate per contenuto: il nome del file e' l'hash
+**     della chiave (v, versione della libreria, formato del payload),
+**     quindi un cambio di versione della libreria invalida tutte le voci.
+**   - Ogni voce inizia con un header che contiene i parametri della chiave
+**     una marca dell'ordine dei byte e due checksum (header e payload),
+**     verificati entrambi ad ogni mappatura della voce.
+**   - Le voci valide vengono mappate in memoria in sola lettura.
+**   - L'occupazione complessiva della directory e' limitata con politica
+**     LRU: la data di ultima modifica funge da marca di ultimo utilizzo.
+**
+** Funzioni definite:
+**   - const Terna_t* cache_apri(size_t v, size_t b, CacheMap* m);
+**   - void cache_chiudi(CacheMap* m);
+**   - bool cache_salva(size_t v, const Terna_t* STSC, size_t b);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/********************************************************************************/
+
+#include "STSC_gen.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+ #include <windows.h>
+ #include <direct.h>
+ #include <sys/utime.h>
+#else
+ #include <dirent.h>
+ #include <fcntl.h>
+ #include <unistd.h>
+ #include <utime.h>
+ #include <sys/mman.h>
+#endif
+
+#define CACHE_MAGIC "STSC"
+#define CACHE_ORDINE 0x01020304U
+#define CACHE_EXT   ".stc"
+
+// FNV-1a a 64 bit, applicato a parole di 32 bit
+#define FNV_OFFSET 0xCBF29CE484222325ULL
+#define FNV_PRIME  0x00000100000001B3ULL
+
+// Header di una voce di cache (56 byte), seguito dalle b terne
+typedef struct {
+    char     magic[4];      // "STSC"
+    uint32_t ordine;        // CACHE_ORDINE, nell'ordine di byte di chi scrive
+    uint32_t riservato;     // Zero, allinea i campi a 64 bit
+    uint32_t versione;      // STSC_LIB_VERSION
+    uint32_t formato;       // CacheFmt
+    uint32_t dim_terna;     // sizeof(Terna_t), controllo di layout
+    uint64_t v;             // Ordine del STS
+    uint64_t b;             // Numero di terne nel payload
+    uint64_t chk_payload;   // Hash del payload
+    uint64_t chk_header;    // Hash di tutti i campi precedenti
+} CacheHeader;
+
+// Voce della directory, per la politica LRU
+typedef struct {
+    char     nome[CACHE_PATH_MAX];
+    uint64_t size;
+    uint64_t mtime;
+} CacheVoce;
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+static uint64_t fnv1a(const void* dati, size_t len, uint64_t h) {
+    const uint32_t* p = (const uint32_t*)dati;
+    for (size_t i = 0; i < len / sizeof(uint32_t); ++i) {
+        h ^= p[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+static const char* cache_dir(void) {
+    const char* dir = getenv("STSC_CACHE_DIR");
+    return ((NULL != dir) && ('\0' != dir[0])) ? dir : CACHE_DIR;
+}
+
+static uint64_t cache_limite(void) {
+    static bool avvisato = false;
+    const char* mb = getenv("STSC_CACHE_MB");
+    uint64_t limite = CACHE_MAX_MB;
+    if (NULL != mb) {
+        char* endptr;
+        unsigned long long x = strtoull(mb, &endptr, 10);
+        if ((endptr == mb) || ('\0' != *endptr) || (x > (UINT64_MAX >> 20))) {
+            if (!avvisato) {
+                avvisato = true;
+                fprintf(stderr, "## Avviso: STSC_CACHE_MB='%s' non valido, uso %u MB.\n",
+                        mb, CACHE_MAX_MB);
+            }
+        } else {
+            limite = x;
+        }
+    }
+    return limite << 20;
+}
+
+/*
+** Nome della voce: hash della chiave (v, versione, formato).
+*/
+static void cache_nome(char* nome, size_t len, size_t v) {
+    uint32_t chiave[4];
+    chiave[0] = (uint32_t)v;
+    chiave[1] = (uint32_t)((uint64_t)v >> 32);
+    chiave[2] = STSC_LIB_VERSION;
+    chiave[3] = CACHE_FMT_TERNE_U32;
+    snprintf(nome, len, "%s/%016llx" CACHE_EXT, cache_dir(),
+             (unsigned long long)fnv1a(chiave, sizeof(chiave), FNV_OFFSET));
+}
+
+static void cache_header(CacheHeader* h, size_t v, const Terna_t* STSC, size_t b) {
+    memset(h, 0, sizeof(*h));
+    memcpy(h->magic, CACHE_MAGIC, sizeof(h->magic));
+    h->ordine      = CACHE_ORDINE;
+    h->versione    = STSC_LIB_VERSION;
+    h->formato     = CACHE_FMT_TERNE_U32;
+    h->dim_terna   = (uint32_t)sizeof(Terna_t);
+    h->v           = v;
+    h->b           = b;
+    h->chk_payload = fnv1a(STSC, b * sizeof(Terna_t), FNV_OFFSET);
+    h->chk_header  = fnv1a(h, offsetof(CacheHeader, chk_header), FNV_OFFSET);
+}
+
+/*
+** Mappa in sola lettura l'intero file. Restituisce false se il file
+** non esiste o non puo' essere mappato.
+*/
+static bool mappa_file(const char* nome, CacheMap* m) {
+    memset(m, 0, sizeof(*m));
+#ifdef _WIN32
+    LARGE_INTEGER dim;
+    HANDLE hf = CreateFileA(nome, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == hf) {
+        return false;
+    }
+    if (!GetFileSizeEx(hf, &dim) || (dim.QuadPart < (LONGLONG)sizeof(CacheHeader))) {
+        CloseHandle(hf);
+        return false;
+    }
+    HANDLE hm = CreateFileMappingA(hf, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (NULL == hm) {
+        CloseHandle(hf);
+        return false;
+    }
+    m->base = MapViewOfFile(hm, FILE_MAP_READ, 0, 0, 0);
+    if (NULL == m->base) {
+        CloseHandle(hm);
+        CloseHandle(hf);
+        return false;
+    }
+    m->size  = (size_t)dim.QuadPart;
+    m->hfile = hf;
+    m->hmap  = hm;
+#else
+    struct stat st;
+    m->fd = open(nome, O_RDONLY);
+    if (m->fd < 0) {
+        return false;
+    }
+    if ((0 != fstat(m->fd, &st)) || (st.st_size < (off_t)sizeof(CacheHeader))) {
+        close(m->fd);
+        return false;
+    }
+    m->base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, m->fd, 0);
+    if (MAP_FAILED == m->base) {
+        m->base = NULL;
+        close(m->fd);
+        return false;
+    }
+    m->size = (size_t)st.st_size;
+#endif
+    return true;
+}
+
+static int confronta_mtime(const void* a, const void* b) {
+    const CacheVoce* x = (const CacheVoce*)a;
+    const CacheVoce* y = (const CacheVoce*)b;
+    return (x->mtime > y->mtime) - (x->mtime < y->mtime);
+}
+
+/*
+** Elenca le voci della directory di cache e, se l'occupazione supera
+** il limite, rimuove le voci usate meno di recente.
+*/
+static void cache_lru(uint64_t limite) {
+    CacheVoce* voci = NULL;
+    size_t nv = 0, cap = 0;
+    uint64_t totale = 0;
+    const char* dir = cache_dir();
+
+#ifdef _WIN32
+    WIN32_FIND_DATAA fd;
+    char filtro[CACHE_PATH_MAX];
+    snprintf(filtro, sizeof(filtro), "%s/*" CACHE_EXT, dir);
+    HANDLE hf = FindFirstFileA(filtro, &fd);
+    if (INVALID_HANDLE_VALUE == hf) {
+        return;
+    }
+    do {
+        if (nv == cap) {
+            CacheVoce* tmp;
+            cap = cap ? 2 * cap : 64;
+            tmp = (CacheVoce*)realloc(voci, cap * sizeof(CacheVoce));
+            if (NULL == tmp) {
+                break;
+            }
+            voci = tmp;
+        }
+        snprintf(voci[nv].nome, CACHE_PATH_MAX, "%s/%s", dir, fd.cFileName);
+        voci[nv].size  = ((uint64_t)fd.nFileSizeHigh << 32) | fd.nFileSizeLow;
+        voci[nv].mtime = ((uint64_t)fd.ftLastWriteTime.dwHighDateTime << 32) |
+                         fd.ftLastWriteTime.dwLowDateTime;
+        totale += voci[nv++].size;
+    } while (FindNextFileA(hf, &fd));
+    FindClose(hf);
+#else
+    struct dirent* de;
+    DIR* d = opendir(dir);
+    if (NULL == d) {
+        return;
+    }
+    while (NULL != (de = readdir(d))) {
+        struct stat st;
+        size_t len = strlen(de->d_name);
+        if ((len < sizeof(CACHE_EXT)) ||
+            (0 != strcmp(de->d_name + len - (sizeof(CACHE_EXT) - 1), CACHE_EXT))) {
+            continue;
+        }
+        if (nv == cap) {
+            CacheVoce* tmp;
+            cap = cap ? 2 * cap : 64;
+            tmp = (CacheVoce*)realloc(voci, cap * sizeof(CacheVoce));
+            if (NULL == tmp) {
+                break;
+            }
+            voci = tmp;
+        }
+        snprintf(voci[nv].nome, CACHE_PATH_MAX, "%s/%s", dir, de->d_name);
+        if (0 != stat(voci[nv].nome, &st)) {
+            continue;
+        }
+        voci[nv].size  = (uint64_t)st.st_size;
+        voci[nv].mtime = (uint64_t)st.st_mtime;
+        totale += voci[nv++].size;
+    }
+    closedir(d);
+#endif
+
+    if (totale > limite) {
+        qsort(voci, nv, sizeof(CacheVoce), confronta_mtime);
+        for (size_t i = 0; (i < nv) && (totale > limite); ++i) {
+            if (0 == remove(voci[i].nome)) {
+                totale -= voci[i].size;
+            }
+        }
+    }
+    free(voci);
+}
+
+/********************************************************************************/
+/*
+** cache_apri()
+**
+** Scopo:
+**   - Cerca nella cache la voce relativa a STS(v) e, se presente e integra,
+**     la mappa in memoria in sola lettura.
+**   - Header e payload sono verificati ad ogni mappatura: il file puo'
+**     essere stato riscritto o danneggiato da un altro processo nel
+**     frattempo. Una voce corrotta, incongruente o scritta con un
+**     diverso ordine dei byte viene rimossa dalla cache.
+**   - Un accesso riuscito aggiorna la marca di ultimo utilizzo (LRU).
+**
+** Parametri:
+**   - v (size_t)     : Ordine del STS.
+**   - b (size_t)     : Numero di terne atteso.
+**   - m (CacheMap *) : Descrittore della mappatura, da rilasciare con
+**                      cache_chiudi() solo in caso di successo.
+**
+** Valore restituito:
+**   - const Terna_t*: Puntatore alle b terne, oppure NULL se assenti.
+*/
+/********************************************************************************/
+const Terna_t* cache_apri(size_t v, size_t b, CacheMap* m) {
+    char nome[CACHE_PATH_MAX];
+    const CacheHeader* h;
+    bool valida;
+
+    cache_nome(nome, sizeof(nome), v);
+
+    // Marca di ultimo utilizzo, prima dell'apertura (Windows non
+    // consente di modificarla su un file aperto in condivisione)
+#ifdef _WIN32
+    _utime(nome, NULL);
+#else
+    utime(nome, NULL);
+#endif
+
+    if (!mappa_file(nome, m)) {
+        return NULL;
+    }
+
+    h = (const CacheHeader*)m->base;
+    valida = (0 == memcmp(h->magic, CACHE_MAGIC, sizeof(h->magic))) &&
+             (CACHE_ORDINE == h->ordine) &&
+             (STSC_LIB_VERSION == h->versione) &&
+             (CACHE_FMT_TERNE_U32 == h->formato) &&
+             (sizeof(Terna_t) == h->dim_terna) &&
+             (v == h->v) && (b == h->b) &&
+             (m->size == sizeof(CacheHeader) + b * sizeof(Terna_t)) &&
+             (h->chk_header == fnv1a(h, offsetof(CacheHeader, chk_header), FNV_OFFSET)) &&
+             (h->chk_payload == fnv1a(h + 1, b * sizeof(Terna_t), FNV_OFFSET));
+
+    if (!valida) {
+        fprintf(stderr, "## Avviso: voce di cache %s non valida, rimossa.\n", nome);
+        cache_chiudi(m);
+        remove(nome);
+        return NULL;
+    }
+
+    return (const Terna_t*)(h + 1);
+}
+
+/********************************************************************************/
+/*
+** cache_chiudi()
+**
+** Scopo:
+**   - Rilascia la mappatura ottenuta con cache_apri().
+**
+** Parametri:
+**   - m (CacheMap *) : Descrittore della mappatura.
+**
+** Valore restituito:
+**   - Nessuno.
+*/
+/********************************************************************************/
+void cache_chiudi(CacheMap* m) {
+    if (NULL == m->base) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m->base);
+    CloseHandle((HANDLE)m->hmap);
+    CloseHandle((HANDLE)m->hfile);
+#else
+    munmap(m->base, m->size);
+    close(m->fd);
+#endif
+    m->base = NULL;
+}
+
+/********************************************************************************/
+/*
+** cache_salva()
+**
+** Scopo:
+**   - Scrive nella cache la voce relativa a STS(v), passando per un file
+**     temporaneo rinominato a scrittura completata: un'interruzione non
+**     lascia mai una voce troncata con il nome definitivo.
+**   - Applica poi il limite di occupazione con politica LRU.
+**
+** Parametri:
+**   - v (size_t)              : Ordine del STS.
+**   - STSC (const Terna_t *)  : Terne del STS(v).
+**   - b (size_t)              : Numero di terne.
+**
+** Valore restituito:
+**   - bool: `true` se la voce e' stata scritta.
+*/
+/********************************************************************************/
+bool cache_salva(size_t v, const Terna_t* STSC, size_t b) {
+    char nome[CACHE_PATH_MAX];
+    char temp[CACHE_PATH_MAX + 4];
+    CacheHeader h;
+    FILE* fp;
+    bool ok;
+    uint64_t limite = cache_limite();
+
+    // Una voce piu' grande dell'intera cache non viene memorizzata
+    if (sizeof(CacheHeader) + b * sizeof(Terna_t) > limite) {
+        return false;
+    }
+
+#ifdef _WIN32
+    _mkdir(cache_dir());
+#else
+    mkdir(cache_dir(), 0755);
+#endif
+
+    cache_nome(nome, sizeof(nome), v);
+    snprintf(temp, sizeof(temp), "%s.tmp", nome);
+    cache_header(&h, v, STSC, b);
+
+    fp = fopen(temp, "wb");
+    if (NULL == fp) {
+        fprintf(stderr, "## Avviso: impossibile scrivere la voce di cache %s.\n", temp);
+        return false;
+    }
+    ok = (1 == fwrite(&h, sizeof(h), 1, fp)) &&
+         (b == fwrite(STSC, sizeof(Terna_t), b, fp));
+    ok = (0 == fclose(fp)) && ok;
+
+    // Su Windows rename() fallisce se la destinazione esiste
+    remove(nome);
+    if (!ok || (0 != rename(temp, nome))) {
+        fprintf(stderr, "## Avviso: impossibile scrivere la voce di cache %s.\n", nome);
+        remove(temp);
+        return false;
+    }
+
+    cache_lru(limite);
+    return true;
+}
+/** EOF: STSC_cache.c **/
@@ -21,7 +21,7 @@
 
 #include "STSC_gen.h"
 
-SysParams sysparms = {false, false, false, 0U, 0U, 0U};
+SysParams sysparms = {false, false, false, true, 0U, 0U, 0U};
 
 /********************************************************************************/
 /*
@@ -32,6 +32,8 @@ SysParams sysparms = {false, false, false, 0U, 0U, 0U};
 **     per un dato valore di v. 
 **   - Richiama la funzione di libreria genera_terne() per creare al volo le
 **     terne differenza dalle formule della Peltesohn.  
+**   - Se la cache e' abilitata, un STS(v) gia' generato in precedenza viene
+**     mappato direttamente dal disco invece di essere rigenerato.
 **   - Se attivata l'opzione, salva l'output su file.
 **
 ** Parametri:
@@ -45,6 +47,8 @@ bool genera_STS_ciclico(void) {
     int di_v;           // Maschera cifre di v e valori terne
     int di_b;           // Maschera cifre del totalizzatore terne 
     Terna_t* STSC;      // Array terne del STS(v) 
+    CacheMap mappa;     // Vista sulla voce di cache, se presente
+    const Terna_t* terne = NULL; // Terne da visualizzare e salvare
     char buff[20];      // Buffer di appoggio per maschere   
 
     // Inizializza i parametri di visualizzazione e gestione 
@@ -83,19 +87,36 @@ bool genera_STS_ciclico(void) {
         }
     }
 
-    // Allocazione buffer per STS(v)
-    STSC = (Terna_t*)malloc(sysparms.b * sizeof(Terna_t));
-    if (NULL == STSC) {
-        fprintf(stderr, "## Errore: Allocazione memoria fallita per %zu terne.\n", sysparms.b);
-        return false;
+    // Ricerca nella cache persistente
+    STSC = NULL;
+    if (sysparms.cache_flg) {
+        terne = cache_apri(sysparms.v, sysparms.b, &mappa);
     }
 
-    // Generazione del STS(v)
-    sysparms.total = Genera_STSC(sysparms.v, STSC);
-    if (0 == sysparms.total) {
-        fprintf(stderr, "## Errore: generazione delle terne STS non riuscita per v=%zu.\n", sysparms.v);
-        free(STSC);
-        return false;
+    if (NULL != terne) {
+        sysparms.total = sysparms.b;
+        printf("** STS(%zu) letto dalla cache.\n", sysparms.v);
+    } else {
+        // Allocazione buffer per STS(v)
+        STSC = (Terna_t*)malloc(sysparms.b * sizeof(Terna_t));
+        if (NULL == STSC) {
+            fprintf(stderr, "## Errore: Allocazione memoria fallita per %zu terne.\n", sysparms.b);
+            return false;
+        }
+
+        // Generazione del STS(v)
+        sysparms.total = Genera_STSC_parallel(sysparms.v, STSC);
+        if (0 == sysparms.total) {
+            fprintf(stderr, "## Errore: generazione delle terne STS non riuscita per v=%zu.\n", sysparms.v);
+            free(STSC);
+            return false;
+        }
+
+        // Un errore di scrittura della cache non e' fatale
+        if (sysparms.cache_flg) {
+            cache_salva(sysparms.v, STSC, sysparms.total);
+        }
+        terne = STSC;
     }
 
     // Visualizza le terne del STS(v)
@@ -103,8 +124,8 @@ bool genera_STS_ciclico(void) {
         printf("\n** Terne del STS(%zu) ciclico:\n", sysparms.v);
         for (size_t i = 0; i < sysparms.total; ++i) {
             printf("%0*zu (%*u, %*u, %*u)\n", 
-               di_b, i+1, di_v, STSC[i].a, 
-               di_v, STSC[i].b, di_v, STSC[i].c);
+               di_b, i+1, di_v, terne[i].a, 
+               di_v, terne[i].b, di_v, terne[i].c);
         }
     }
 
@@ -120,16 +141,23 @@ bool genera_STS_ciclico(void) {
         fp = fopen(fname, "w+");
         if (!fp) {
             fprintf(stderr, "## Errore: impossibile aprire il file %s in scrittura.\n", fname);
+            if (NULL == STSC) {
+                cache_chiudi(&mappa);
+            }
+            free(STSC);
             return false;
         }
         fprintf(fp, "a,b,c,%zu,%zu\n", sysparms.v, sysparms.b);
         for (size_t i = 0; i < sysparms.b; ++i) {
-            fprintf(fp, "%u,%u,%u\n", STSC[i].a, STSC[i].b, STSC[i].c);
+            fprintf(fp, "%u,%u,%u\n", terne[i].a, terne[i].b, terne[i].c);
         }
         fclose(fp);
     }
 
     printf("** Generazione STSC completata con successo per v=%zu. Numero di terne: %zu.\n", sysparms.v, sysparms.total);
+    if (NULL == STSC) {
+        cache_chiudi(&mappa);
+    }
     free(STSC);
     return true;
 }
@@ -128,6 +128,8 @@ bool run_batch_mode(size_t min, size_t max) {
 **   - Esegue una batterie di test che genera un insieme predefinito di STS,
 **     da confrontare con i file di riferimento generati tramite spreadsheet
 **     contenuti nella cartella \REFDATA.   
+**   - La cache persistente e' sempre esclusa, in modo che ogni STS sia
+**     effettivamente prodotto dal generatore.
 **
 ** Parametri:
 **   - Nessuno.
@@ -148,6 +150,7 @@ bool run_test_mode(void) {
 ** per ognuno dei sei casi parametrici in k.
 */
     printf("**** Modalita' di test: generazione di STS noti. ****\n");
+    sysparms.cache_flg = false;
 
     for (size_t i = 0U; i < num_tests; i++) {
         sysparms.v = test_values[i];
@@ -178,6 +181,7 @@ bool run_test_mode(void) {
 **
 ** Scopo:
 **   - Analizza gli argomenti della riga di comando e imposta la modalita' operativa.
+**   - L'opzione iniziale /nocache disabilita la cache persistente.
 **
 ** Parametri:
 **   - argc (int)        : Numero di argomenti.
@@ -190,6 +194,13 @@ bool run_test_mode(void) {
 */
 /********************************************************************************/
 Mode parse_args(int argc, char *argv[], size_t *min, size_t *max) {
+    // Opzione /nocache, che precede l'eventuale modalita'
+    if ((argc >= 2) && (strcmp(argv[1], "/nocache") == 0)) {
+        sysparms.cache_flg = false;
+        --argc;
+        ++argv;
+    }
+
     if (argc < 2) {
         return MODE_INTERACTIVE;
     }
@@ -0,0 +1,470 @@
+/************************************************************************/
+/* Composizione ricorsiva di sistemi tripli di Steiner di ordine molto
+** elevato, con generazione delle terne su richiesta.
+**
+** Costruzioni implementate, a partire da uno STS(u) sui punti 0..u-1:
+**   - Raddoppio STS(2u+1): punti X = 0..u-1, Y = u..2u-1, oo = 2u.
+**     Oltre alle terne di STS(u), per ogni x in X le terne {x, y, y'}
+**     con {y, y'} lato del fattore F_x della 1-fattorizzazione GK(u+1)
+**     di K(u+1) su Y + {oo}:
+**       F_x = {oo, x} + {x - j, x + j} (mod u), j = 1..(u-1)/2.
+**   - Triplicazione STS(3u): punti (x, i) = x + i*u, i in Z_3.
+**     Le u terne verticali {(x,0), (x,1), (x,2)}, seguite per ogni terna
+**     {a, b, c} di STS(u) dalle 9 terne {(a,i), (b,j), (c,k)} con
+**     i + j + k = 0 (mod 3).
+**
+** Basi: STS(1), STS(3), uno STS ciclico di Genera_STSC() con al piu'
+** SOGLIA_BASE punti oppure, se la catena si interrompe su un ordine
+** maggiore (u = 1 mod 12, oppure u = 33 mod 36), una costruzione diretta:
+**   - Bose, u = 6n+3: punti (x, i) = x + i*N, N = 2n+1, con il
+**     quasigruppo idempotente x o y = (n+1)(x+y) mod N. Le N terne
+**     verticali, poi {(x,i), (y,i), (x o y, i+1)} per x != y.
+**   - Skolem, u = 6n+1: come sopra con N = 2n e oo = 3N, usando il
+**     quasigruppo semi-idempotente x o y = s/2 oppure (s-1)/2 + n, con
+**     s = x + y mod N. Le n verticali (x < n), le 3n terne {oo, (x+n,i),
+**     (x,i+1)}, poi {(x,i), (y,i), (x o y, i+1)} per x != y.
+** Le coppie {x, y} sono numerate come {x, x+d mod N}, d = 1..N/2.
+**
+** Riferimenti:
+** Charles J. Colbourn, Alexander Rosa, 1999.
+** "Triple Systems".
+** Oxford University Press, Capp. 2 e 3.
+**
+** Charles C. Lindner, Christopher A. Rodger, 2008.
+** "Design Theory", 2nd Ed.
+** CRC Press, Cap. 1 (costruzioni di Bose e Skolem).
+**
+** La catena di costruzioni viene pianificata una sola volta: ogni terna
+** del sistema complessivo si ottiene dall'indice scendendo la catena,
+** senza memorizzare nulla oltre ai descrittori dei livelli e alle terne
+** differenza della base ciclica. L'ordine delle terne alla base coincide
+** con quello di Genera_STSC().
+**
+** Compilare come eseguibile abilitando il simbolo STS_COMP_TEST per un
+** test run automatico, oppure STS_COMP_BENCH per il confronto con la
+** generazione diretta.
+**
+** Funzioni esportate:
+**   size_t STS_comp_base(size_t v);
+**   bool STS_comp_init(STS_comp_t* c, size_t v);
+**   Terna_t STS_comp_terna(const STS_comp_t* c, size_t i);
+**   size_t STS_comp_intervallo(const STS_comp_t* c, size_t da, size_t n,
+**                              Terna_t* STS);
+**   void STS_comp_libera(STS_comp_t* c);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "STS_comp.h"
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+// Ordini ammissibili come livello di composizione, incluse le basi banali
+static bool ammissibile(size_t u) {
+    return (u % 6 == 1) || (u % 6 == 3);
+}
+
+/*
+** Coppia p-esima {x, x+d mod N} di Z_N: x = p mod N, d = p / N + 1.
+** Per N pari la classe d = N/2 e' ridotta alle N/2 coppie con x < N/2,
+** che sono le ultime: basta non superare C(N,2).
+*/
+static void coppia(uint64_t N, uint64_t p, uint64_t* x, uint64_t* y) {
+    *x = p % N;
+    *y = (*x + p / N + 1) % N;
+}
+
+// Terna i delle basi dirette di Bose e Skolem
+static Terna_t terna_diretta(const STS_comp_t* c, size_t i) {
+    const bool     bose = (STS_BOSE == c->liv[0].op);
+    const uint64_t n = c->liv[0].v / 6;
+    const uint64_t N = bose ? 2 * n + 1 : 2 * n;
+    const uint64_t V = bose ? N : n;       // Terne verticali
+    uint64_t k, r, x, y, z, s;
+
+    if (i < V) {
+        return (Terna_t) {(uint32_t)i, (uint32_t)(i + N), (uint32_t)(i + 2 * N)};
+    }
+    k = i - V;
+    if (!bose) {
+        if (k < 3 * n) {
+            x = k % n;
+            r = k / n;
+            return (Terna_t) {(uint32_t)(3 * N), (uint32_t)(x + n + r * N),
+                              (uint32_t)(x + ((r + 1) % 3) * N)};
+        }
+        k -= 3 * n;
+    }
+
+    r = k % 3;
+    coppia(N, k / 3, &x, &y);
+    s = (x + y) % N;
+    if (bose) {
+        z = ((n + 1) * s) % N;
+    } else {
+        z = (0 == (s & 1)) ? s / 2 : (s - 1) / 2 + n;
+    }
+    return (Terna_t) {(uint32_t)(x + r * N), (uint32_t)(y + r * N),
+                      (uint32_t)(z + ((r + 1) % 3) * N)};
+}
+
+// Terna i della base: banale, oppure sviluppo ciclico come in Genera_STSC()
+static Terna_t terna_base(const STS_comp_t* c, size_t i) {
+    const uint32_t v = c->liv[0].v;
+    uint32_t orb, j;
+
+    if (STS_BASE != c->liv[0].op) {
+        return terna_diretta(c, i);
+    }
+    if (3 == v) {
+        return (Terna_t) {0, 1, 2};
+    }
+
+    orb = (uint32_t)(i / v);
+    j   = (uint32_t)(i % v);
+    if (orb < c->td) {
+        return (Terna_t) {j, (c->TDiff[orb].a + j) % v,
+                          (c->TDiff[orb].a + c->TDiff[orb].b + j) % v};
+    }
+
+    // Short orbit, solo se v = 6n + 3
+    return (Terna_t) {j, j + v / 3, j + 2 * (v / 3)};
+}
+
+/*
+** Scomposizione dall'alto: si prosegue oltre SOGLIA_BASE solo se la base
+** non sarebbe generabile ciclicamente (v = 9). Restituisce il numero di
+** livelli sopra la base e lascia in *v l'ordine della base.
+** Se nessuna costruzione riduce u, la catena si ferma e la base sara'
+** diretta (vedi tipo_base()).
+*/
+static size_t scomponi(size_t* v, STS_livello_t* liv) {
+    size_t n = 0;
+    size_t u = *v;
+
+    while ((u > SOGLIA_BASE) || ((u > 3) && !Convalida_v(u))) {
+        STS_op_t op;
+        if ((0 == u % 3) && ammissibile(u / 3)) {
+            op = STS_TRIPLICAZIONE;
+        } else if (ammissibile((u - 1) / 2)) {
+            op = STS_RADDOPPIO;
+        } else {
+            break;
+        }
+        if (NULL != liv) {
+            liv[n].v  = (uint32_t)u;
+            liv[n].op = op;
+            liv[n].b  = Totale_terne_STS(u);
+        }
+        u = (STS_TRIPLICAZIONE == op) ? u / 3 : (u - 1) / 2;
+        n += 1;
+    }
+    *v = u;
+    return n;
+}
+
+// Costruzione della base di ordine u: ciclica solo entro SOGLIA_BASE
+static STS_op_t tipo_base(size_t u) {
+    if ((u <= 3) || ((u <= SOGLIA_BASE) && Convalida_v(u))) {
+        return STS_BASE;
+    }
+    return (3 == u % 6) ? STS_BOSE : STS_SKOLEM;
+}
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+size_t STS_comp_base(size_t v) {
+    if (!ammissibile(v)) {
+        return 0U;
+    }
+    scomponi(&v, NULL);
+    return v;
+}
+
+bool STS_comp_init(STS_comp_t* c, size_t v) {
+    STS_livello_t tmp[MAX_LIVELLI];
+    size_t n;
+    Terna_t* TD;
+
+    memset(c, 0, sizeof(*c));
+    if (!ammissibile(v) || (v > UINT32_MAX)) {
+        fprintf(stderr, ">> LIB_STS.STS_comp_init(): ERRORE\n"
+                ">>    Controllo di congruenza fallito per v = %zu\n\n", v);
+        return false;
+    }
+
+    n = scomponi(&v, tmp);
+
+    // Base
+    c->liv[0].v  = (uint32_t)v;
+    c->liv[0].op = tipo_base(v);
+    c->liv[0].b  = Totale_terne_STS(v);
+    if ((STS_BASE == c->liv[0].op) && (v > 3)) {
+        TD = Genera_terne_differenza(v, &c->td);
+        if (NULL == TD) {
+            fprintf(stderr, ">> LIB_STS.STS_comp_init(): ERRORE\n"
+                    ">>    Base ciclica STS(%zu) non generabile.\n\n", v);
+            return false;
+        }
+        c->TDiff = (Terna_t*)malloc(c->td * sizeof(Terna_t));
+        if (NULL == c->TDiff) {
+            fputs("Errore di allocazione!\n", stderr);
+            return false;
+        }
+        memcpy(c->TDiff, TD, c->td * sizeof(Terna_t));
+    }
+
+    // Livelli in ordine crescente
+    c->livelli = n + 1;
+    for (size_t l = 1; l <= n; ++l) {
+        c->liv[l] = tmp[n - l];
+    }
+    c->v = c->liv[n].v;
+    c->b = c->liv[n].b;
+    return true;
+}
+
+Terna_t STS_comp_terna(const STS_comp_t* c, size_t i) {
+    size_t  sel[MAX_LIVELLI];   // Combinazione (i, j) di ogni triplicazione
+    size_t  ns = 0;
+    size_t  l = c->livelli - 1;
+    Terna_t t;
+
+    // Discesa della catena fino al livello che produce direttamente la terna
+    for (;;) {
+        const STS_livello_t* L = &c->liv[l];
+
+        if (0 == l) {
+            t = terna_base(c, i);
+            break;
+        }
+
+        const uint32_t u = c->liv[l - 1].v;
+        if (STS_RADDOPPIO == L->op) {
+            if (i < c->liv[l - 1].b) {
+                l -= 1;
+                continue;
+            }
+            // Fattore x, lato j di GK(u+1)
+            size_t   k = i - c->liv[l - 1].b;
+            uint32_t m = (u + 1) / 2;
+            uint32_t x = (uint32_t)(k / m);
+            uint32_t j = (uint32_t)(k % m);
+            if (0 == j) {
+                t = (Terna_t) {x, u + x, 2 * u};
+            } else {
+                t = (Terna_t) {x, u + (x + u - j) % u, u + (x + j) % u};
+            }
+            break;
+        }
+
+        // STS_TRIPLICAZIONE
+        if (i < u) {
+            t = (Terna_t) {(uint32_t)i, (uint32_t)i + u, (uint32_t)i + 2 * u};
+            break;
+        }
+        sel[ns++] = (i - u) % 9;
+        i = (i - u) / 9;
+        l -= 1;
+    }
+
+    // Risalita: si applicano i livelli delle triplicazioni attraversate
+    while (ns > 0) {
+        size_t   r = sel[--ns];
+        uint32_t a = (uint32_t)(r / 3);
+        uint32_t b = (uint32_t)(r % 3);
+        uint32_t u;
+
+        // Il livello corrispondente e' la prossima triplicazione sopra l
+        do {
+            l += 1;
+        } while (STS_TRIPLICAZIONE != c->liv[l].op);
+        u = c->liv[l - 1].v;
+        t.a += a * u;
+        t.b += b * u;
+        t.c += ((6 - a - b) % 3) * u;
+    }
+
+    return t;
+}
+
+size_t STS_comp_intervallo(const STS_comp_t* c, size_t da, size_t n, Terna_t* STS) {
+    if (da >= c->b) {
+        return 0U;
+    }
+    if (n > c->b - da) {
+        n = c->b - da;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        STS[i] = STS_comp_terna(c, da + i);
+    }
+    return n;
+}
+
+void STS_comp_libera(STS_comp_t* c) {
+    free(c->TDiff);
+    c->TDiff = NULL;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(STS_COMP_TEST)
+/*
+** Verifica tramite bitmap delle coppie: ogni coppia di punti deve
+** comparire in esattamente una terna.
+*/
+static bool verifica(const STS_comp_t* c) {
+    size_t    v = c->v;
+    uint64_t* bm = (uint64_t*)calloc(v * (v - 1) / 128 + 1, sizeof(uint64_t));
+    bool      ok = (NULL != bm);
+
+    for (size_t i = 0; ok && (i < c->b); ++i) {
+        Terna_t  t = STS_comp_terna(c, i);
+        uint32_t p[3] = {t.a, t.b, t.c};
+        for (size_t h = 0; ok && (h < 3); ++h) {
+            uint32_t x = p[h], y = p[(h + 1) % 3];
+            if (x > y) { uint32_t s = x; x = y; y = s; }
+            size_t k = (size_t)y * (y - 1) / 2 + x;
+            ok = (y < v) && (x != y) && !(bm[k >> 6] & (1ULL << (k & 63)));
+            if (ok) bm[k >> 6] |= 1ULL << (k & 63);
+        }
+    }
+    free(bm);
+    return ok;
+}
+
+int main() {
+    size_t fallimenti = 0;
+
+    for (size_t v = 3; v <= 2200; ++v) {
+        STS_comp_t c;
+        if (!ammissibile(v)) {
+            continue;
+        }
+        if (!STS_comp_init(&c, v)) {
+            ++fallimenti;
+            continue;
+        }
+        if (!verifica(&c)) {
+            printf("** STS(%zu): ERRATO\n", v);
+            ++fallimenti;
+        } else if (v < 100 || 0 == v % 243) {
+            printf("** STS(%4zu): %7zu terne, base %3u, %zu livelli, verificato\n",
+                   v, c.b, c.liv[0].v, c.livelli);
+        }
+        STS_comp_libera(&c);
+    }
+
+    // Ordini oltre il limite di Genera_terne_differenza(): basi dirette
+    const size_t grandi[] = {60013, 80059, 1000003};
+    for (size_t k = 0; k < sizeof(grandi) / sizeof(grandi[0]); ++k) {
+        STS_comp_t c;
+        uint64_t   x = 88172645463325252ULL;
+        bool       ok, completa = (grandi[k] < 100000);
+
+        if (!STS_comp_init(&c, grandi[k])) {
+            ++fallimenti;
+            continue;
+        }
+        ok = (c.liv[0].v <= SOGLIA_BASE) || (STS_BASE != c.liv[0].op);
+        if (completa) {
+            ok = ok && verifica(&c);
+        } else {
+            /*
+            ** La bitmap delle coppie richiederebbe v(v-1)/2 bit (62 GB per
+            ** v = 10^6): un campione di terne casuali controlla solo punti
+            ** e indici, non la copertura delle coppie, e l'esito lo dichiara.
+            */
+            for (size_t i = 0; ok && (i < 10000000); ++i) {
+                x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                Terna_t t = STS_comp_terna(&c, (size_t)(x % c.b));
+                ok = (t.a < c.v) && (t.b < c.v) && (t.c < c.v) &&
+                     (t.a != t.b) && (t.b != t.c) && (t.a != t.c);
+            }
+        }
+        printf("** STS(%zu): %zu terne, base %u (%s), %zu livelli, %s\n",
+               c.v, c.b, c.liv[0].v, (STS_BASE == c.liv[0].op) ? "ciclica" :
+               (STS_BOSE == c.liv[0].op) ? "Bose" : "Skolem", c.livelli,
+               !ok ? "ERRATO" : completa ? "verificato" : "campione");
+        fallimenti += !ok;
+        STS_comp_libera(&c);
+    }
+    printf("** %zu fallimenti\n", fallimenti);
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#elif defined(STS_COMP_BENCH)
+#include <time.h>
+
+/*
+** Confronto di throughput tra Genera_STSC() e la composizione ricorsiva,
+** piu' l'accesso casuale a singole terne di sistemi di ordine elevato.
+*/
+int main() {
+    const size_t ordini[] = {1023, 3279, 9841, 29523};
+    const size_t grandi[] = {(size_t)1594323, (size_t)14348907, (size_t)3486784401U};
+
+    printf("%10s %12s %6s %10s %10s %12s\n",
+           "v", "terne", "liv", "diretto", "composto", "terne/s");
+    for (size_t k = 0; k < sizeof(ordini) / sizeof(ordini[0]); ++k) {
+        size_t     v = ordini[k];
+        size_t     b = Totale_terne_STS(v);
+        Terna_t*   STS = (Terna_t*)malloc(b * sizeof(Terna_t));
+        STS_comp_t c;
+        double     td = -1.0, tc;
+        clock_t    t0;
+
+        if ((NULL == STS) || !STS_comp_init(&c, v)) {
+            free(STS);
+            continue;
+        }
+        if (Convalida_v(v)) {
+            t0 = clock();
+            Genera_STSC(v, STS);
+            td = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        }
+        t0 = clock();
+        STS_comp_intervallo(&c, 0, b, STS);
+        tc = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("%10zu %12zu %6zu %10.3f %10.3f %12.0f\n", v, b, c.livelli,
+               td, tc, (tc > 0.0) ? (double)b / tc : 0.0);
+        STS_comp_libera(&c);
+        free(STS);
+    }
+
+    // Accesso casuale: sistemi non memorizzabili per intero
+    for (size_t k = 0; k < sizeof(grandi) / sizeof(grandi[0]); ++k) {
+        STS_comp_t c;
+        uint64_t   x = 88172645463325252ULL, chk = 0;
+        const size_t n = 10000000;
+        clock_t    t0;
+        double     tc;
+
+        if (!STS_comp_init(&c, grandi[k])) {
+            continue;
+        }
+        t0 = clock();
+        for (size_t i = 0; i < n; ++i) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            Terna_t t = STS_comp_terna(&c, (size_t)(x % c.b));
+            chk += t.a ^ t.b ^ t.c;
+        }
+        tc = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("%10zu %12zu %6zu %10s %10.3f %12.0f (casuale, chk %llx)\n",
+               c.v, c.b, c.livelli, "-", tc, (double)n / tc,
+               (unsigned long long)chk);
+        STS_comp_libera(&c);
+    }
+    return EXIT_SUCCESS;
+}
+#endif
+/** EOF: STS_comp.c **/
@@ -0,0 +1,248 @@
+/************************************************************************/
+/* Generatore di suite di test a coppie (pairwise) basate su sistemi
+** tripli di Steiner: ogni coppia di parametri compare in esattamente un
+** caso di test.
+**
+** Dati p parametri si sceglie il minimo v >= p ammissibile, si genera lo
+** STS(v) su richiesta tramite STS_comp e si troncano i punti p..v-1.
+** Il numero di casi e' circa p^2/6, contro le p(p-1)/2 coppie: ogni caso
+** di tre parametri copre tre coppie.
+**
+** Compilare come eseguibile abilitando il simbolo COPERTURA_TOOL per lo
+** strumento a riga di comando, oppure STS_COPERTURA_TEST per un test run
+** automatico con misura dei tempi.
+**
+** Funzioni esportate:
+**   size_t Ordine_copertura(size_t p);
+**   uint64_t Genera_copertura(size_t p, Caso_sink_t sink, void* ctx);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "STS_copertura.h"
+#include "STS_comp.h"
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+size_t Ordine_copertura(size_t p) {
+    size_t v = (p < 3) ? 3 : p;
+    while ((v % 6 != 1) && (v % 6 != 3)) {
+        ++v;
+    }
+    return v;
+}
+
+uint64_t Genera_copertura(size_t p, Caso_sink_t sink, void* ctx) {
+    Terna_t    buf[COPERTURA_BLOCCO];
+    STS_comp_t c;
+    uint64_t   tot = 0;
+    bool       continua = true;
+
+    if ((p < 2) || (NULL == sink)) {
+        fprintf(stderr, ">> LIB_STS.Genera_copertura(): ERRORE\n"
+                ">>    Parametri non validi: p = %zu, sink %s\n\n",
+                p, (NULL == sink) ? "assente" : "presente");
+        return 0;
+    }
+
+    if (!STS_comp_init(&c, Ordine_copertura(p))) {
+        return 0;
+    }
+
+    for (size_t da = 0; continua && (da < c.b); da += COPERTURA_BLOCCO) {
+        size_t n = STS_comp_intervallo(&c, da, COPERTURA_BLOCCO, buf);
+
+        for (size_t i = 0; continua && (i < n); ++i) {
+            Caso_t caso;
+            caso.n = 0;
+            if (buf[i].a < p) caso.p[caso.n++] = buf[i].a;
+            if (buf[i].b < p) caso.p[caso.n++] = buf[i].b;
+            if (buf[i].c < p) caso.p[caso.n++] = buf[i].c;
+            if (caso.n < 2) {
+                continue;
+            }
+            if (2 == caso.n) {
+                caso.p[2] = 0;
+            }
+            ++tot;
+            continua = sink(&caso, ctx);
+        }
+    }
+
+    STS_comp_libera(&c);
+    return tot;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(COPERTURA_TOOL)
+// Dimensione del buffer di uscita
+#define DIM_USCITA (1U << 20)
+
+typedef struct {
+    FILE*  fp;
+    bool   binario;
+    size_t len;
+    char   buf[DIM_USCITA];
+} Uscita_t;
+
+static char* scrivi_u32(char* s, uint32_t x) {
+    char tmp[10];
+    int  n = 0;
+    do {
+        tmp[n++] = (char)('0' + x % 10);
+        x /= 10;
+    } while (x);
+    while (n) {
+        *s++ = tmp[--n];
+    }
+    return s;
+}
+
+static bool svuota(Uscita_t* u) {
+    bool ok = (u->len == fwrite(u->buf, 1, u->len, u->fp));
+    u->len = 0;
+    return ok;
+}
+
+/*
+** Formato testo: una riga "a,b,c" per caso, "a,b," per i casi di due
+** parametri. Formato binario: tre uint32_t per caso, UINT32_MAX come
+** terzo elemento dei casi di due parametri.
+*/
+static bool uscita_sink(const Caso_t* c, void* ctx) {
+    Uscita_t* u = (Uscita_t*)ctx;
+
+    if (u->len + 64 > DIM_USCITA && !svuota(u)) {
+        return false;
+    }
+    if (u->binario) {
+        uint32_t t[3] = {c->p[0], c->p[1], (3 == c->n) ? c->p[2] : UINT32_MAX};
+        memcpy(u->buf + u->len, t, sizeof(t));
+        u->len += sizeof(t);
+    } else {
+        char* s = u->buf + u->len;
+        s = scrivi_u32(s, c->p[0]);
+        *s++ = ',';
+        s = scrivi_u32(s, c->p[1]);
+        *s++ = ',';
+        if (3 == c->n) {
+            s = scrivi_u32(s, c->p[2]);
+        }
+        *s++ = '\n';
+        u->len = (size_t)(s - u->buf);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    static Uscita_t u;
+    uint64_t tot;
+    size_t p;
+
+    if ((argc < 2) || (argc > 4) || (0 == (p = strtoul(argv[1], NULL, 10)))) {
+        fprintf(stderr, "Uso: %s p [-b] [file]\n"
+                "  Genera una suite di test a coppie per p parametri.\n"
+                "  -b: uscita binaria (3 x uint32_t per caso).\n"
+                "  Senza file, l'uscita e' su stdout.\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    u.fp = stdout;
+    for (int i = 2; i < argc; ++i) {
+        if (0 == strcmp(argv[i], "-b")) {
+            u.binario = true;
+        } else if (NULL == (u.fp = fopen(argv[i], "wb"))) {
+            fprintf(stderr, "## Errore: impossibile aprire il file %s in scrittura.\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!u.binario) {
+        fprintf(u.fp, "a,b,c,%zu,%zu\n", p, Ordine_copertura(p));
+    }
+    tot = Genera_copertura(p, uscita_sink, &u);
+    if (!svuota(&u) || (0 == tot) || (0 != fclose(u.fp))) {
+        fprintf(stderr, "## Errore: generazione o scrittura non riuscita.\n");
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, "** %llu casi di test per %zu parametri (STS(%zu) troncato)\n",
+            (unsigned long long)tot, p, Ordine_copertura(p));
+    return EXIT_SUCCESS;
+}
+#elif defined(STS_COPERTURA_TEST)
+#include <time.h>
+
+// Verifica a bitmap: ogni coppia di parametri coperta esattamente una volta
+typedef struct {
+    size_t    p;
+    uint64_t* bm;
+    uint64_t  errori;
+} Verifica_t;
+
+static bool verifica_sink(const Caso_t* c, void* ctx) {
+    Verifica_t* vf = (Verifica_t*)ctx;
+    for (uint32_t i = 0; i < c->n; ++i) {
+        for (uint32_t j = i + 1; j < c->n; ++j) {
+            size_t x = c->p[i], y = c->p[j];
+            if (x > y) { size_t s = x; x = y; y = s; }
+            size_t k = y * (y - 1) / 2 + x;
+            if ((y >= vf->p) || (x == y) || (vf->bm[k >> 6] & (1ULL << (k & 63)))) {
+                vf->errori += 1;
+            } else {
+                vf->bm[k >> 6] |= 1ULL << (k & 63);
+            }
+        }
+    }
+    return true;
+}
+
+static bool conta_sink(const Caso_t* c, void* ctx) {
+    *(uint64_t*)ctx += c->p[0] ^ c->p[1] ^ c->p[2];
+    return true;
+}
+
+int main() {
+    size_t fallimenti = 0;
+    const size_t grandi[] = {10000, 30000, 60000, 100000};
+
+    for (size_t p = 2; p <= 400; ++p) {
+        size_t     coppie = p * (p - 1) / 2;
+        Verifica_t vf = {p, (uint64_t*)calloc(coppie / 64 + 1, sizeof(uint64_t)), 0};
+        Genera_copertura(p, verifica_sink, &vf);
+        // Nessuna coppia ripetuta: restano da contare le coppie coperte
+        size_t coperte = 0;
+        for (size_t k = 0; k < coppie / 64 + 1; ++k) {
+            for (uint64_t w = vf.bm[k]; w; w &= w - 1) {
+                ++coperte;
+            }
+        }
+        if ((0 != vf.errori) || (coperte != coppie)) {
+            printf("** p = %zu: ERRATO\n", p);
+            ++fallimenti;
+        }
+        free(vf.bm);
+    }
+    printf("** Copertura verificata per 2 <= p <= 400: %zu fallimenti\n", fallimenti);
+
+    for (size_t i = 0; i < sizeof(grandi) / sizeof(grandi[0]); ++i) {
+        uint64_t chk = 0, tot;
+        clock_t t0 = clock();
+        tot = Genera_copertura(grandi[i], conta_sink, &chk);
+        double sec = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("** p = %6zu (v = %6zu): %11llu casi in %.2f s (chk %llx)\n",
+               grandi[i], Ordine_copertura(grandi[i]), (unsigned long long)tot,
+               sec, (unsigned long long)chk);
+    }
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#endif
+/** EOF: STS_copertura.c **/
@@ -0,0 +1,465 @@
+/************************************************************************/
+/* Ricerca esaustiva di insiemi alternativi di terne differenza per il
+** problema di Heffter, come exact cover con i dancing links di Knuth.
+**
+** Le tabelle di Peltesohn forniscono una sola soluzione per ogni v: qui
+** si enumerano tutte le partizioni delle differenze in terne, ognuna
+** delle quali, sviluppata con Genera_STSC_da_terne(), produce uno STS
+** ciclico in generale non isomorfo a quello di Genera_STSC().
+**
+** Riferimenti:
+** Donald E. Knuth, 2000.
+** "Dancing links".
+** Millennial Perspectives in Computer Science, pp. 187-214.
+** arXiv: cs/0011047
+**
+** Compilare come eseguibile abilitando il simbolo STS_DLX_TEST per un
+** test run automatico.
+**
+** Funzioni esportate:
+**   size_t Cerca_terne_differenza(size_t v, size_t limite, bool canoniche,
+**                                 TD_sink_t sink, void* ctx);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
+#include "STS_dlx.h"
+
+// Nodo della matrice sparsa; le intestazioni di colonna usano size
+typedef struct Nodo {
+    struct Nodo *L, *R, *U, *D;
+    struct Nodo *C;         // Intestazione della colonna
+    uint32_t riga;          // Indice della terna candidata
+    uint32_t size;          // Nodi attivi nella colonna (solo intestazioni)
+} Nodo_t;
+
+// Parametri condivisi tra i thread
+typedef struct {
+    size_t          v;
+    size_t          n;          // Terne per soluzione
+    size_t          nc;         // Colonne (differenze)
+    size_t          nr;         // Righe (terne candidate)
+    Terna_t*        righe;
+    uint32_t*       colonna;    // Differenza -> colonna
+    size_t          limite;
+    bool            canoniche;
+    TD_sink_t       sink;
+    void*           ctx;
+    size_t          trovate;
+    volatile bool   stop;
+} Problema_t;
+
+// Matrice privata di un thread
+typedef struct {
+    Nodo_t*     pool;
+    Nodo_t*     radice;
+    Nodo_t**    primo;          // Primo nodo di ogni riga
+    uint32_t*   sol;
+    size_t      prof;
+    Terna_t*    tmp;            // Soluzione corrente e immagini (2n terne)
+    Problema_t* P;
+} Dlx_t;
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+/* Si usa la tecnica dei dancing links di Knuth */
+static void copri(Nodo_t* c) {
+    c->R->L = c->L;
+    c->L->R = c->R;
+    for (Nodo_t* i = c->D; i != c; i = i->D) {
+        for (Nodo_t* j = i->R; j != i; j = j->R) {
+            j->D->U = j->U;
+            j->U->D = j->D;
+            j->C->size -= 1;
+        }
+    }
+}
+
+static void scopri(Nodo_t* c) {
+    for (Nodo_t* i = c->U; i != c; i = i->U) {
+        for (Nodo_t* j = i->L; j != i; j = j->L) {
+            j->C->size += 1;
+            j->D->U = j;
+            j->U->D = j;
+        }
+    }
+    c->R->L = c;
+    c->L->R = c;
+}
+
+// Costruzione della matrice: radice, nc intestazioni, 3 nodi per riga
+static bool costruisci(Dlx_t* X, Problema_t* P) {
+    Nodo_t* h;
+    Nodo_t* p;
+
+    memset(X, 0, sizeof(*X));
+    X->P = P;
+    X->pool  = (Nodo_t*)calloc(1 + P->nc + 3 * P->nr, sizeof(Nodo_t));
+    X->primo = (Nodo_t**)malloc(P->nr * sizeof(Nodo_t*));
+    X->sol   = (uint32_t*)malloc(P->n * sizeof(uint32_t));
+    X->tmp   = (Terna_t*)malloc(2 * P->n * sizeof(Terna_t));
+    if ((NULL == X->pool) || (NULL == X->primo) || (NULL == X->sol) || (NULL == X->tmp)) {
+        return false;
+    }
+
+    X->radice = X->pool;
+    h = X->pool + 1;
+    X->radice->L = h + P->nc - 1;
+    X->radice->R = h;
+    for (size_t i = 0; i < P->nc; ++i) {
+        h[i].L = (0 == i) ? X->radice : &h[i - 1];
+        h[i].R = (P->nc - 1 == i) ? X->radice : &h[i + 1];
+        h[i].U = h[i].D = h[i].C = &h[i];
+    }
+
+    p = h + P->nc;
+    for (size_t r = 0; r < P->nr; ++r) {
+        const uint32_t d[3] = {P->righe[r].a, P->righe[r].b, P->righe[r].c};
+        X->primo[r] = p;
+        for (size_t k = 0; k < 3; ++k) {
+            Nodo_t* c = &h[P->colonna[d[k]]];
+            p[k].L = &p[(k + 2) % 3];
+            p[k].R = &p[(k + 1) % 3];
+            p[k].C = c;
+            p[k].D = c;
+            p[k].U = c->U;
+            c->U->D = &p[k];
+            c->U = &p[k];
+            c->size += 1;
+            p[k].riga = (uint32_t)r;
+        }
+        p += 3;
+    }
+    return true;
+}
+
+static void distruggi(Dlx_t* X) {
+    free(X->pool);
+    free(X->primo);
+    free(X->sol);
+    free(X->tmp);
+}
+
+static int confronta_terne(const void* x, const void* y) {
+    const Terna_t* s = (const Terna_t*)x;
+    const Terna_t* t = (const Terna_t*)y;
+    if (s->a != t->a) return (s->a < t->a) ? -1 : 1;
+    if (s->b != t->b) return (s->b < t->b) ? -1 : 1;
+    if (s->c != t->c) return (s->c < t->c) ? -1 : 1;
+    return 0;
+}
+
+// Immagine ripiegata in 1..(v-1)/2 della differenza x moltiplicata per m
+static uint32_t ripiega(size_t x, size_t m, size_t v) {
+    size_t y = (x * m) % v;
+    return (uint32_t)((y > v / 2) ? v - y : y);
+}
+
+static size_t mcd(size_t a, size_t b) {
+    while (b) {
+        size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/*
+** Forma normale: ogni terna ordinata, terne in ordine lessicografico.
+** La soluzione e' canonica se nessun moltiplicatore ne produce una forma
+** normale minore; m e -m danno la stessa immagine, basta m <= v/2.
+*/
+static bool canonica(const Terna_t* S, size_t n, size_t v, Terna_t* img) {
+    for (size_t m = 2; m <= v / 2; ++m) {
+        if (1 != mcd(m, v)) {
+            continue;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t x[3] = {ripiega(S[i].a, m, v), ripiega(S[i].b, m, v),
+                             ripiega(S[i].c, m, v)};
+            if (x[0] > x[1]) { uint32_t t = x[0]; x[0] = x[1]; x[1] = t; }
+            if (x[1] > x[2]) { uint32_t t = x[1]; x[1] = x[2]; x[2] = t; }
+            if (x[0] > x[1]) { uint32_t t = x[0]; x[0] = x[1]; x[1] = t; }
+            img[i] = (Terna_t) {x[0], x[1], x[2]};
+        }
+        qsort(img, n, sizeof(Terna_t), confronta_terne);
+        for (size_t i = 0; i < n; ++i) {
+            int c = confronta_terne(&img[i], &S[i]);
+            if (c < 0) {
+                return false;
+            }
+            if (c > 0) {
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+static void soluzione(Dlx_t* X) {
+    Problema_t* P = X->P;
+    Terna_t*    S = X->tmp;
+
+    for (size_t i = 0; i < P->n; ++i) {
+        S[i] = P->righe[X->sol[i]];
+    }
+    if (P->canoniche) {
+        qsort(S, P->n, sizeof(Terna_t), confronta_terne);
+        if (!canonica(S, P->n, P->v, S + P->n)) {
+            return;
+        }
+    }
+
+#ifdef _OPENMP
+    #pragma omp critical (dlx_sink)
+#endif
+    if (!P->stop) {
+        P->trovate += 1;
+        if ((NULL != P->sink) && !P->sink(S, P->n, P->ctx)) {
+            P->stop = true;
+        }
+        if ((0 != P->limite) && (P->trovate >= P->limite)) {
+            P->stop = true;
+        }
+    }
+}
+
+// Algoritmo X, con scelta della colonna di cardinalita' minima
+static void cerca(Dlx_t* X) {
+    Nodo_t* c;
+
+    if (X->radice->R == X->radice) {
+        soluzione(X);
+        return;
+    }
+
+    c = X->radice->R;
+    for (Nodo_t* j = c->R; j != X->radice; j = j->R) {
+        if (j->size < c->size) {
+            c = j;
+        }
+    }
+    if (0 == c->size) {
+        return;
+    }
+
+    copri(c);
+    for (Nodo_t* r = c->D; (r != c) && !X->P->stop; r = r->D) {
+        X->sol[X->prof++] = r->riga;
+        for (Nodo_t* j = r->R; j != r; j = j->R) {
+            copri(j->C);
+        }
+        cerca(X);
+        for (Nodo_t* j = r->L; j != r; j = j->L) {
+            scopri(j->C);
+        }
+        X->prof -= 1;
+    }
+    scopri(c);
+}
+
+// Sottoalbero della k-esima riga contenente la differenza 1 (colonna 0)
+static void sottoalbero(Dlx_t* X, size_t r) {
+    Nodo_t* p = X->primo[r];
+    Nodo_t* c = p->C;
+
+    copri(c);
+    X->sol[0] = (uint32_t)r;
+    X->prof = 1;
+    for (Nodo_t* j = p->R; j != p; j = j->R) {
+        copri(j->C);
+    }
+    cerca(X);
+    for (Nodo_t* j = p->L; j != p; j = j->L) {
+        scopri(j->C);
+    }
+    scopri(c);
+}
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+size_t Cerca_terne_differenza(size_t v, size_t limite, bool canoniche,
+                              TD_sink_t sink, void* ctx) {
+    Problema_t P;
+    size_t     max_d = v / 2;
+    size_t     escluso = (v % 6 == 3) ? v / 3 : 0;
+    size_t     nr1 = 0;         // Righe che contengono la differenza 1
+    bool       ok = true;
+
+    if (!Convalida_v(v)) {
+        fprintf(stderr, ">> LIB_STS.Cerca_terne_differenza(): ERRORE\n"
+                ">>    Controllo di congruenza fallito per v = %zu\n\n", v);
+        return 0U;
+    }
+
+    memset(&P, 0, sizeof(P));
+    P.v = v;
+    P.n = (v - 1) / 6;
+    P.limite = limite;
+    P.canoniche = canoniche;
+    P.sink = sink;
+    P.ctx = ctx;
+
+    // Colonne: differenze 1..(v-1)/2, escluso v/3 (short orbit)
+    P.colonna = (uint32_t*)malloc((max_d + 1) * sizeof(uint32_t));
+    P.righe = (Terna_t*)malloc(max_d * max_d * sizeof(Terna_t));
+    if ((NULL == P.colonna) || (NULL == P.righe)) {
+        fputs("Errore di allocazione!\n", stderr);
+        free(P.colonna);
+        free(P.righe);
+        return 0U;
+    }
+    for (size_t d = 1; d <= max_d; ++d) {
+        P.colonna[d] = (d == escluso) ? UINT32_MAX : (uint32_t)P.nc++;
+    }
+
+    // Righe: terne a < b < c con a + b = c oppure a + b + c = v.
+    // Generate per a crescente: le righe con a = 1 sono le prime nr1.
+    for (size_t a = 1; a <= max_d; ++a) {
+        if (a == escluso) continue;
+        for (size_t b = a + 1; b <= max_d; ++b) {
+            size_t c1 = a + b, c2 = v - a - b;
+            if (b == escluso) continue;
+            if ((c1 <= max_d) && (c1 != escluso)) {
+                P.righe[P.nr++] = (Terna_t) {(uint32_t)a, (uint32_t)b, (uint32_t)c1};
+            }
+            if ((c2 > b) && (c2 <= max_d) && (c2 != escluso)) {
+                P.righe[P.nr++] = (Terna_t) {(uint32_t)a, (uint32_t)b, (uint32_t)c2};
+            }
+        }
+        if (1 == a) {
+            nr1 = P.nr;
+        }
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel reduction(&&:ok)
+#endif
+    {
+        Dlx_t X;
+        ok = costruisci(&X, &P);
+#ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 1)
+#endif
+        for (long long r = 0; r < (long long)nr1; ++r) {
+            if (ok && !P.stop) {
+                sottoalbero(&X, (size_t)r);
+            }
+        }
+        distruggi(&X);
+    }
+
+    free(P.colonna);
+    free(P.righe);
+    if (!ok) {
+        fputs("Errore di allocazione!\n", stderr);
+    }
+    return P.trovate;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(STS_DLX_TEST)
+#include <time.h>
+
+// Ogni soluzione viene sviluppata e verificata come STS(v)
+typedef struct {
+    size_t   v;
+    Terna_t* STS;
+    uint8_t* coppie;
+    size_t   errori;
+} Verifica_t;
+
+static bool verifica_sink(const Terna_t* TDiff, size_t td, void* ctx) {
+    Verifica_t* vf = (Verifica_t*)ctx;
+    size_t v = vf->v;
+    size_t b = Genera_STSC_da_terne(v, TDiff, td, vf->STS);
+
+    if (b != Totale_terne_STS(v)) {
+        vf->errori += 1;
+        return true;
+    }
+    memset(vf->coppie, 0, v * v);
+    for (size_t i = 0; i < b; ++i) {
+        const uint32_t p[3] = {vf->STS[i].a, vf->STS[i].b, vf->STS[i].c};
+        for (size_t h = 0; h < 3; ++h) {
+            uint8_t* x = &vf->coppie[p[h] * v + p[(h + 1) % 3]];
+            vf->errori += (*x != 0);
+            *x = 1;
+            vf->coppie[p[(h + 1) % 3] * v + p[h]] = 1;
+        }
+    }
+    return true;
+}
+
+int main() {
+    const size_t ordini[] = {7, 13, 15, 19, 21, 25, 27, 31, 33, 37, 39};
+    size_t fallimenti = 0;
+
+    for (size_t i = 0; i < sizeof(ordini) / sizeof(ordini[0]); ++i) {
+        size_t v = ordini[i];
+        Verifica_t vf = {v, (Terna_t*)malloc(Totale_terne_STS(v) * sizeof(Terna_t)),
+                         (uint8_t*)malloc(v * v), 0};
+        clock_t t0 = clock();
+        size_t tutte = Cerca_terne_differenza(v, 0, false, verifica_sink, &vf);
+        size_t classi = Cerca_terne_differenza(v, 0, true, NULL, NULL);
+        double sec = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+        printf("** v = %2zu: %8zu soluzioni, %6zu classi per moltiplicatori, %s, %.2f s\n",
+               v, tutte, classi, vf.errori ? "ERRATO" : "verificato", sec);
+        fallimenti += (0 != vf.errori) || (0 == tutte);
+        free(vf.STS);
+        free(vf.coppie);
+    }
+
+    // Basi di Peltesohn con terne di somma a + b > v/2, la cui differenza
+    // c va ripiegata: Genera_STSC_da_terne() deve accettarle
+    for (size_t i = 0; i < sizeof(ordini) / sizeof(ordini[0]); ++i) {
+        size_t v = ordini[i], td, oltre = 0;
+        const Terna_t* TD = Genera_terne_differenza(v, &td);
+        Verifica_t vf = {v, (Terna_t*)malloc(Totale_terne_STS(v) * sizeof(Terna_t)),
+                         (uint8_t*)malloc(v * v), 0};
+
+        for (size_t j = 0; (NULL != TD) && (j < td); ++j) {
+            oltre += ((size_t)TD[j].a + TD[j].b > v / 2);
+        }
+        if ((NULL != TD) && (oltre > 0)) {
+            verifica_sink(TD, td, &vf);
+            printf("** v = %2zu: base di Peltesohn con %zu terne a + b > v/2, %s\n",
+                   v, oltre, vf.errori ? "ERRATO" : "verificato");
+            fallimenti += (0 != vf.errori);
+        }
+        free(vf.STS);
+        free(vf.coppie);
+    }
+
+    // Limite sul numero di soluzioni, per ordini dove l'enumerazione
+    // completa non e' praticabile
+    for (size_t v = 61; v <= 301; v += 60) {
+        Verifica_t vf = {v, (Terna_t*)malloc(Totale_terne_STS(v) * sizeof(Terna_t)),
+                         (uint8_t*)malloc(v * v), 0};
+        clock_t t0 = clock();
+        size_t n = Cerca_terne_differenza(v, 10, false, verifica_sink, &vf);
+        printf("** v = %3zu: %zu soluzioni (limite 10), %s, %.2f s\n", v, n,
+               vf.errori ? "ERRATO" : "verificato", (double)(clock() - t0) / CLOCKS_PER_SEC);
+        fallimenti += (0 != vf.errori) || (10 != n);
+        free(vf.STS);
+        free(vf.coppie);
+    }
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#endif
+/** EOF: STS_dlx.c **/
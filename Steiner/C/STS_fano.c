@@ -0,0 +1,321 @@
+/************************************************************************/
+/* Ricerca dei sottosistemi STS(7) (piani di Fano) contenuti in un
+** sistema triplo di Steiner, tramite la tabella del quasigruppo.
+**
+** Un piano di Fano e' generato da tre punti non allineati a, b, e:
+** posto c = a.b, d = a.e, f = b.e, g = c.e, i sette punti formano un
+** sottosistema se e solo se a.f = g, b.d = g, c.d = f.
+** Imponendo a < b < e, ogni punto di a, b, e minimo tra i candidati
+** restanti, ogni sottosistema viene generato una sola volta.
+**
+** Per gli STS ciclici prodotti da Genera_STSC() la ricerca viene
+** ancorata al punto 0: il numero di sottosistemi per ogni punto e'
+** costante (N0), quindi il totale e' N0 * v / 7, con costo O(v^2)
+** anziche' O(v^3).
+**
+** Compilare come eseguibile abilitando il simbolo STS_FANO_TEST per un
+** test run automatico con misura dei tempi.
+**
+** Funzioni esportate:
+**   uint32_t* STS_quasigruppo(size_t v, const Terna_t* STS, size_t b);
+**   bool STS_ciclico(size_t v, const uint32_t* Q, const Terna_t* STS,
+**                    size_t b);
+**   uint64_t Conta_Fano(size_t v, const Terna_t* STS, size_t b,
+**                       Fano_sink_t sink, void* ctx);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
+#include "STS_fano.h"
+
+// Parametri condivisi dalla ricerca
+typedef struct {
+    size_t          v;
+    const uint32_t* Q;
+    bool            ciclico;    // Ancoraggio al punto 0 ed emissione per traslazione
+    Fano_sink_t     sink;
+    void*           ctx;
+    volatile bool   stop;       // Richiesta di interruzione dal sink
+} Ricerca_t;
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+/*
+** Inoltra al sink un sottosistema, oppure tutti i suoi traslati S + t con
+** minimo t (ossia senza riduzione modulare: t < v - max(S)).
+*/
+static void emetti(Ricerca_t* r, const Fano_t* S) {
+    uint32_t max = 0;
+    size_t   nt = 1;
+
+    if (r->ciclico) {
+        for (size_t i = 0; i < 7; ++i) {
+            if (S->p[i] > max) max = S->p[i];
+        }
+        nt = r->v - max;
+    }
+
+#ifdef _OPENMP
+    #pragma omp critical (fano_sink)
+#endif
+    for (uint32_t t = 0; !r->stop && (t < nt); ++t) {
+        Fano_t T;
+        for (size_t i = 0; i < 7; ++i) {
+            T.p[i] = S->p[i] + t;
+        }
+        if (!r->sink(&T, r->ctx)) {
+            r->stop = true;
+        }
+    }
+}
+
+// Sottosistemi con generatori canonici a < b < e, a e b fissati
+static uint64_t cerca_ab(Ricerca_t* r, uint32_t a, uint32_t b) {
+    const size_t    v = r->v;
+    const uint32_t* Q = r->Q;
+    const uint32_t* Qa = Q + (size_t)a * v;
+    const uint32_t* Qb = Q + (size_t)b * v;
+    const uint32_t  c = Qa[b];
+    const uint32_t* Qc;
+    uint64_t        n = 0;
+
+    if (c < b) {
+        return 0;
+    }
+    Qc = Q + (size_t)c * v;
+
+    for (uint32_t e = b + 1; e < v; ++e) {
+        uint32_t d, f, g;
+        if (e == c) {
+            continue;
+        }
+        d = Qa[e];
+        f = Qb[e];
+        g = Qc[e];
+        // e minimo dei punti fuori dalla retta {a, b, c}
+        if ((d < e) || (f < e) || (g < e)) {
+            continue;
+        }
+        if ((Qa[f] == g) && (Q[(size_t)b * v + d] == g) && (Qc[d] == f)) {
+            n += 1;
+            if (NULL != r->sink) {
+                Fano_t S = {{a, b, c, e, d, f, g}};
+                emetti(r, &S);
+            }
+        }
+    }
+    return n;
+}
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+uint32_t* STS_quasigruppo(size_t v, const Terna_t* STS, size_t b) {
+    uint32_t* Q;
+
+    if ((NULL == STS) || (b != Totale_terne_STS(v))) {
+        fprintf(stderr, ">> LIB_STS.STS_quasigruppo(): ERRORE\n"
+                ">>    Numero di terne incongruente per v = %zu\n\n", v);
+        return NULL;
+    }
+
+    Q = (uint32_t*)malloc(v * v * sizeof(uint32_t));
+    if (NULL == Q) {
+        fputs("Errore di allocazione!\n", stderr);
+        return NULL;
+    }
+    // Celle non assegnate marcate con v, diagonale idempotente
+    for (size_t x = 0; x < v * v; ++x) {
+        Q[x] = (uint32_t)v;
+    }
+    for (size_t x = 0; x < v; ++x) {
+        Q[x * v + x] = (uint32_t)x;
+    }
+
+    for (size_t i = 0; i < b; ++i) {
+        const size_t a = STS[i].a, bb = STS[i].b, c = STS[i].c;
+        if ((a >= v) || (bb >= v) || (c >= v) || (Q[a * v + bb] != v) ||
+            (Q[a * v + c] != v) || (Q[bb * v + c] != v)) {
+            fprintf(stderr, ">> LIB_STS.STS_quasigruppo(): ERRORE\n"
+                    ">>    Terna %zu non valida: (%zu, %zu, %zu)\n\n", i, a, bb, c);
+            free(Q);
+            return NULL;
+        }
+        Q[a * v + bb] = Q[bb * v + a] = (uint32_t)c;
+        Q[a * v + c]  = Q[c * v + a]  = (uint32_t)bb;
+        Q[bb * v + c] = Q[c * v + bb] = (uint32_t)a;
+    }
+    return Q;
+}
+
+bool STS_ciclico(size_t v, const uint32_t* Q, const Terna_t* STS, size_t b) {
+    for (size_t i = 0; i < b; ++i) {
+        size_t x = (STS[i].a + 1) % v;
+        size_t y = (STS[i].b + 1) % v;
+        if (Q[x * v + y] != (STS[i].c + 1) % v) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t Conta_Fano(size_t v, const Terna_t* STS, size_t b,
+                    Fano_sink_t sink, void* ctx) {
+    Ricerca_t r;
+    uint64_t  n = 0;
+    long long tot;              // Coppie (a, b) da esplorare
+    uint32_t* Q = STS_quasigruppo(v, STS, b);
+
+    if (NULL == Q) {
+        return 0;
+    }
+
+    r.v = v;
+    r.Q = Q;
+    r.ciclico = STS_ciclico(v, Q, STS, b);
+    r.sink = sink;
+    r.ctx = ctx;
+    r.stop = false;
+
+    // Caso ciclico: solo a = 0; caso generale: tutte le coppie a < b
+    tot = (long long)(r.ciclico ? v : v * v);
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 16) reduction(+:n)
+#endif
+    for (long long k = 0; k < tot; ++k) {
+        uint32_t a = (uint32_t)(k / (long long)v);
+        uint32_t bb = (uint32_t)(k % (long long)v);
+        if ((bb > a) && !r.stop) {
+            n += cerca_ab(&r, a, bb);
+        }
+    }
+
+    free(Q);
+    if (r.ciclico) {
+        n = n * v / 7;
+    }
+    return n;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(STS_FANO_TEST)
+#include <time.h>
+#include "STS_comp.h"
+
+// Verifica nel sink che ogni sottosistema emesso sia chiuso
+typedef struct {
+    const uint32_t* Q;
+    size_t          v;
+    uint64_t        n;
+    uint64_t        errori;
+} Controllo_t;
+
+static bool controllo_sink(const Fano_t* f, void* ctx) {
+    static const uint8_t rette[7][3] = {{0,1,2}, {0,3,4}, {1,3,5}, {2,3,6},
+                                        {0,5,6}, {1,4,6}, {2,4,5}};
+    Controllo_t* c = (Controllo_t*)ctx;
+    c->n += 1;
+    for (size_t i = 0; i < 7; ++i) {
+        const uint32_t* p = f->p;
+        if ((p[rette[i][2]] >= c->v) ||
+            (c->Q[p[rette[i][0]] * c->v + p[rette[i][1]]] != p[rette[i][2]])) {
+            c->errori += 1;
+        }
+    }
+    return true;
+}
+
+/*
+** Scambiando le etichette 0 e 1 lo STS non e' piu' ciclico: la ricerca
+** generale deve ritrovare lo stesso numero di sottosistemi.
+*/
+static bool prova_generale(size_t v, const Terna_t* STS, size_t b, uint64_t atteso) {
+    Terna_t* P = (Terna_t*)malloc(b * sizeof(Terna_t));
+    uint64_t n;
+
+    if (NULL == P) {
+        return false;
+    }
+    for (size_t i = 0; i < b; ++i) {
+        P[i] = STS[i];
+        P[i].a = (P[i].a < 2) ? 1 - P[i].a : P[i].a;
+        P[i].b = (P[i].b < 2) ? 1 - P[i].b : P[i].b;
+        P[i].c = (P[i].c < 2) ? 1 - P[i].c : P[i].c;
+    }
+    n = Conta_Fano(v, P, b, NULL, NULL);
+    free(P);
+    return n == atteso;
+}
+
+static bool prova(size_t v, const Terna_t* STS, size_t b, const char* nome) {
+    Controllo_t c = {NULL, v, 0, 0};
+    uint64_t n, ne;
+    clock_t t0 = clock();
+    bool ok;
+
+    n = Conta_Fano(v, STS, b, NULL, NULL);
+    double sec = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    c.Q = STS_quasigruppo(v, STS, b);
+    ne = Conta_Fano(v, STS, b, controllo_sink, &c);
+    ok = (NULL != c.Q) && (n == ne) && (c.n == n) && (0 == c.errori);
+    if (ok && (v < 500)) {
+        ok = prova_generale(v, STS, b, n);
+    }
+    printf("** %-8s STS(%4zu): %8llu sottosistemi STS(7), %s, %.3f s (CPU)\n",
+           nome, v, (unsigned long long)n, ok ? "verificato" : "ERRATO", sec);
+    free((void*)c.Q);
+    return ok;
+}
+
+int main() {
+    size_t fallimenti = 0;
+    const size_t ordini[] = {7, 13, 15, 21, 31, 49, 63, 91, 127, 199, 399, 1023, 2047};
+
+    // STS ciclici: ricerca ancorata al punto 0
+    for (size_t i = 0; i < sizeof(ordini) / sizeof(ordini[0]); ++i) {
+        size_t v = ordini[i];
+        size_t b = Totale_terne_STS(v);
+        Terna_t* STS = (Terna_t*)malloc(b * sizeof(Terna_t));
+        if ((NULL == STS) || (Genera_STSC(v, STS) != b) ||
+            !prova(v, STS, b, "ciclico")) {
+            ++fallimenti;
+        }
+        free(STS);
+    }
+
+    // STS composti (non ciclici): ricerca generale
+    const size_t composti[] = {67, 127, 135, 255};
+    for (size_t i = 0; i < sizeof(composti) / sizeof(composti[0]); ++i) {
+        size_t v = composti[i];
+        STS_comp_t sc;
+        Terna_t* STS;
+        if (!STS_comp_init(&sc, v)) {
+            ++fallimenti;
+            continue;
+        }
+        STS = (Terna_t*)malloc(sc.b * sizeof(Terna_t));
+        if ((NULL == STS) || (STS_comp_intervallo(&sc, 0, sc.b, STS) != sc.b) ||
+            !prova(v, STS, sc.b, "composto")) {
+            ++fallimenti;
+        }
+        free(STS);
+        STS_comp_libera(&sc);
+    }
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#endif
+/** EOF: STS_fano.c **/
@@ -0,0 +1,323 @@
+/************************************************************************/
+/* Grafo di intersezione dei blocchi di uno STS in formato CSR, per i
+** job di colorazione e le analisi su grafo.
+**
+** Due terne sono adiacenti se condividono un punto. In uno STS(v) ogni
+** punto appartiene a r = (v-1)/2 terne e due terne distinte hanno al
+** piu' un punto in comune: il grafo e' quindi regolare di grado 3(r-1)
+** e ogni riga e' l'unione disgiunta di tre liste di incidenza.
+**
+** Compilare come eseguibile abilitando il simbolo STS_GRAFO_TEST per un
+** test run automatico con confronto a forza bruta e round-trip su file.
+**
+** Funzioni esportate:
+**   bool STS_grafo_costruisci(size_t v, const Terna_t* STS, size_t b,
+**                             STS_grafo_t* g);
+**   bool STS_grafo_scrivi(const STS_grafo_t* g, const char* nome);
+**   bool STS_grafo_da_memoria(const void* base, size_t size, STS_grafo_t* g);
+**   void STS_grafo_libera(STS_grafo_t* g);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _OPENMP
+ #include <omp.h>
+#endif
+#include "STS_grafo.h"
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+/*
+** Fusione ordinata delle tre liste di incidenza (ordinate per indice di
+** blocco), escludendo il blocco stesso che compare in tutte e tre.
+** Un blocco che compare due volte condivide con i due punti: la coppia
+** e' coperta piu' volte e la funzione restituisce false.
+*/
+static bool fondi_riga(const uint32_t* l0, const uint32_t* l1, const uint32_t* l2,
+                       uint32_t r, uint32_t i, uint32_t* out) {
+    uint32_t k0 = 0, k1 = 0, k2 = 0;
+    const uint32_t fine = UINT32_MAX;
+    uint32_t prec = fine;
+
+    for (;;) {
+        uint32_t x0 = (k0 < r) ? l0[k0] : fine;
+        uint32_t x1 = (k1 < r) ? l1[k1] : fine;
+        uint32_t x2 = (k2 < r) ? l2[k2] : fine;
+        uint32_t m;
+
+        if (x0 <= x1 && x0 <= x2) {
+            m = x0;
+            ++k0;
+        } else if (x1 <= x2) {
+            m = x1;
+            ++k1;
+        } else {
+            m = x2;
+            ++k2;
+        }
+        if (fine == m) {
+            return true;
+        }
+        if (m != i) {
+            if (m == prec) {
+                return false;
+            }
+            *out++ = prec = m;
+        }
+    }
+}
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+bool STS_grafo_costruisci(size_t v, const Terna_t* STS, size_t b, STS_grafo_t* g) {
+    const uint32_t r = (uint32_t)((v - 1) / 2);
+    uint32_t* inc;              // Incidenza: r blocchi per ogni punto
+    uint32_t* cnt;
+    bool      ok = true;
+
+    memset(g, 0, sizeof(*g));
+    if ((v < 3) || (b != Totale_terne_STS(v)) || (b >= UINT32_MAX)) {
+        fprintf(stderr, ">> LIB_STS.STS_grafo_costruisci(): ERRORE\n"
+                ">>    Parametri incongruenti: v = %zu, b = %zu\n\n", v, b);
+        return false;
+    }
+
+    g->v     = (uint32_t)v;
+    g->grado = 3 * (r - 1);
+    g->nodi  = b;
+    g->archi = (uint64_t)b * g->grado;
+
+    inc = (uint32_t*)malloc(v * r * sizeof(uint32_t));
+    cnt = (uint32_t*)calloc(v, sizeof(uint32_t));
+    g->mem = malloc((b + 1) * sizeof(uint64_t) + g->archi * sizeof(uint32_t));
+    if ((NULL == inc) || (NULL == cnt) || (NULL == g->mem)) {
+        fputs("Errore di allocazione!\n", stderr);
+        free(inc);
+        free(cnt);
+        STS_grafo_libera(g);
+        return false;
+    }
+    g->righe = (uint64_t*)g->mem;
+    g->col   = (uint32_t*)(g->righe + b + 1);
+
+    // Incidenza punto -> blocchi, in ordine crescente di blocco
+    for (size_t i = 0; ok && (i < b); ++i) {
+        const uint32_t p[3] = {STS[i].a, STS[i].b, STS[i].c};
+        if ((p[0] == p[1]) || (p[1] == p[2]) || (p[0] == p[2])) {
+            ok = false;
+            break;
+        }
+        for (size_t h = 0; h < 3; ++h) {
+            if ((p[h] >= v) || (cnt[p[h]] >= r)) {
+                ok = false;
+                break;
+            }
+            inc[(size_t)p[h] * r + cnt[p[h]]++] = (uint32_t)i;
+        }
+    }
+    free(cnt);
+
+    /*
+    ** Righe a grado costante: ogni riga e' indipendente dalle altre.
+    ** Con punti distinti, ogni punto in r terne e b = v(v-1)/6, nessuna
+    ** coppia ripetuta in una riga equivale a ogni coppia coperta una volta.
+    */
+    if (ok) {
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(static) reduction(&&:ok)
+#endif
+        for (long long i = 0; i < (long long)b; ++i) {
+            g->righe[i] = (uint64_t)i * g->grado;
+            ok = fondi_riga(inc + (size_t)STS[i].a * r, inc + (size_t)STS[i].b * r,
+                            inc + (size_t)STS[i].c * r, r, (uint32_t)i,
+                            g->col + (size_t)i * g->grado) && ok;
+        }
+        g->righe[b] = g->archi;
+    }
+
+    free(inc);
+    if (!ok) {
+        fprintf(stderr, ">> LIB_STS.STS_grafo_costruisci(): ERRORE\n"
+                ">>    Le terne non formano uno STS(%zu).\n\n", v);
+        STS_grafo_libera(g);
+        return false;
+    }
+    return true;
+}
+
+bool STS_grafo_scrivi(const STS_grafo_t* g, const char* nome) {
+    GrafoHeader h;
+    FILE* fp;
+    bool  ok;
+
+    memcpy(h.magic, GRAFO_MAGIC, sizeof(h.magic));
+    h.versione = GRAFO_VERSIONE;
+    h.v        = g->v;
+    h.grado    = g->grado;
+    h.nodi     = g->nodi;
+    h.archi    = g->archi;
+
+    fp = fopen(nome, "wb");
+    if (NULL == fp) {
+        fprintf(stderr, ">> LIB_STS.STS_grafo_scrivi(): ERRORE\n"
+                ">>    Impossibile creare il file %s\n\n", nome);
+        return false;
+    }
+    ok = (1 == fwrite(&h, sizeof(h), 1, fp)) &&
+         (g->nodi + 1 == fwrite(g->righe, sizeof(uint64_t), (size_t)g->nodi + 1, fp)) &&
+         (g->archi == fwrite(g->col, sizeof(uint32_t), (size_t)g->archi, fp));
+    ok = (0 == fclose(fp)) && ok;
+    if (!ok) {
+        fprintf(stderr, ">> LIB_STS.STS_grafo_scrivi(): ERRORE\n"
+                ">>    Scrittura fallita su %s\n\n", nome);
+        remove(nome);
+    }
+    return ok;
+}
+
+bool STS_grafo_da_memoria(const void* base, size_t size, STS_grafo_t* g) {
+    const GrafoHeader* h = (const GrafoHeader*)base;
+
+    memset(g, 0, sizeof(*g));
+    if ((NULL == base) || (size < sizeof(GrafoHeader)) ||
+        (0 != memcmp(h->magic, GRAFO_MAGIC, sizeof(h->magic))) ||
+        (GRAFO_VERSIONE != h->versione) ||
+        (h->archi != h->nodi * h->grado) ||
+        (size != sizeof(GrafoHeader) + (h->nodi + 1) * sizeof(uint64_t) +
+                 h->archi * sizeof(uint32_t))) {
+        return false;
+    }
+
+    g->v     = h->v;
+    g->grado = h->grado;
+    g->nodi  = h->nodi;
+    g->archi = h->archi;
+    g->righe = (uint64_t*)(h + 1);
+    g->col   = (uint32_t*)(g->righe + g->nodi + 1);
+    return true;
+}
+
+void STS_grafo_libera(STS_grafo_t* g) {
+    free(g->mem);
+    g->mem = NULL;
+    g->righe = NULL;
+    g->col = NULL;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(STS_GRAFO_TEST)
+#include <time.h>
+
+static bool adiacenti(const Terna_t* x, const Terna_t* y) {
+    return (x->a == y->a) || (x->a == y->b) || (x->a == y->c) ||
+           (x->b == y->a) || (x->b == y->b) || (x->b == y->c) ||
+           (x->c == y->a) || (x->c == y->b) || (x->c == y->c);
+}
+
+// Confronto O(b^2) con la definizione, righe ordinate
+static bool forza_bruta(const STS_grafo_t* g, const Terna_t* STS) {
+    for (size_t i = 0; i < g->nodi; ++i) {
+        const uint32_t* riga = g->col + g->righe[i];
+        size_t k = 0;
+        for (size_t j = 0; j < g->nodi; ++j) {
+            if ((j != i) && adiacenti(&STS[i], &STS[j])) {
+                if ((k >= g->grado) || (riga[k++] != j)) {
+                    return false;
+                }
+            }
+        }
+        if (k != g->grado) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Round-trip su file, con lettura integrale al posto della mappatura
+static bool round_trip(const STS_grafo_t* g, const char* nome) {
+    STS_grafo_t m;
+    FILE* fp;
+    size_t size;
+    void* buf;
+    bool ok;
+
+    if (!STS_grafo_scrivi(g, nome) || (NULL == (fp = fopen(nome, "rb")))) {
+        return false;
+    }
+    fseek(fp, 0, SEEK_END);
+    size = (size_t)ftell(fp);
+    rewind(fp);
+    buf = malloc(size);
+    ok = (NULL != buf) && (size == fread(buf, 1, size, fp));
+    fclose(fp);
+    remove(nome);
+
+    ok = ok && STS_grafo_da_memoria(buf, size, &m) &&
+         (0 == memcmp(m.righe, g->righe, (g->nodi + 1) * sizeof(uint64_t))) &&
+         (0 == memcmp(m.col, g->col, g->archi * sizeof(uint32_t)));
+    free(buf);
+    return ok;
+}
+
+int main() {
+    const size_t ordini[] = {7, 13, 15, 19, 31, 63, 99, 255, 511, 729};
+    size_t fallimenti = 0;
+
+    for (size_t i = 0; i < sizeof(ordini) / sizeof(ordini[0]); ++i) {
+        size_t v = ordini[i];
+        size_t b = Totale_terne_STS(v);
+        Terna_t* STS = (Terna_t*)malloc(b * sizeof(Terna_t));
+        STS_grafo_t g;
+        bool ok;
+        clock_t t0;
+        double sec;
+
+        if ((NULL == STS) || (Genera_STSC(v, STS) != b)) {
+            free(STS);
+            ++fallimenti;
+            continue;
+        }
+        t0 = clock();
+        ok = STS_grafo_costruisci(v, STS, b, &g);
+        sec = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        ok = ok && ((v > 255) || forza_bruta(&g, STS)) && round_trip(&g, "sts_grafo.tmp");
+        printf("** STS(%4zu): %8zu nodi, grado %4u, %11llu archi, %s, %.3f s (CPU)\n",
+               v, b, g.grado, (unsigned long long)g.archi / 2,
+               ok ? "verificato" : "ERRATO", sec);
+        fallimenti += !ok;
+        STS_grafo_libera(&g);
+        free(STS);
+    }
+
+    // Terne corrotte: punto ripetuto, e scambio che copre una coppia due volte
+    {
+        Terna_t STS[26];
+        STS_grafo_t g;
+        uint32_t x;
+        bool ok = (26 == Genera_STSC(13, STS));
+
+        STS[0].b = STS[0].a;
+        ok = ok && !STS_grafo_costruisci(13, STS, 26, &g);
+        Genera_STSC(13, STS);
+        x = STS[0].c;
+        STS[0].c = STS[1].c;
+        STS[1].c = x;
+        ok = ok && ((STS[0].c == STS[1].c) || !STS_grafo_costruisci(13, STS, 26, &g));
+        printf("** Terne corrotte: %s\n", ok ? "rifiutate" : "ERRATO");
+        fallimenti += !ok;
+    }
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#endif
+/** EOF: STS_grafo.c **/
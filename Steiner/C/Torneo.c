@@ -0,0 +1,335 @@
+/************************************************************************/
+/* Calendario del girone all'italiana (round-robin) ricavato dal QLCI di
+** genera_qlci() in QLCI.c, senza memorizzare il quadrato.
+**
+** Il QLCI di ordine m dispari e' la tabella di un quasigruppo
+** idempotente e commutativo: la cella (i, j) e' la giornata in cui si
+** incontrano le squadre i e j, e in ogni giornata la squadra sulla
+** diagonale riposa. La prima riga di genera_qlci() vale
+** (x >> 1) + 1 + (x & 1) * (m + 1) / 2 nella colonna x, e le righe
+** successive ne sono rotazioni: la cella (i, j) dipende solo da
+** i + j (mod m), e risolvendo si ottiene i + j = 2g (mod m) per la
+** giornata g (contata da zero). Tutte le funzioni sono quindi O(1) per
+** cella e non allocano la matrice n x n.
+**
+** Con n pari si usa il QLCI di ordine n - 1 e la squadra a riposo
+** incontra la squadra n - 1 (metodo classico del "polo").
+**
+** Compilare come eseguibile abilitando il simbolo TORNEO_TEST per un
+** test run automatico (confronto con genera_qlci(), incluso da QLCI.c),
+** oppure TORNEO_BENCH per il benchmark fino a
+** 10^5 squadre.
+**
+** Funzioni esportate:
+**   size_t Torneo_giornate(size_t n);
+**   uint32_t Torneo_avversario(size_t n, size_t g, size_t s);
+**   size_t Torneo_giornata_di(size_t n, size_t i, size_t j);
+**   size_t Torneo_giornata(size_t n, size_t g, Incontro_t* inc);
+**   bool Torneo_scrivi(size_t n, const char* nome);
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Torneo.h"
+
+/********************************************************************************/
+// Funzioni interne
+/********************************************************************************/
+
+// Ordine del QLCI sottostante: n se dispari, n - 1 se pari
+static size_t ordine(size_t n) {
+    return n - (1 ^ (n & 1));
+}
+
+static bool convalida(size_t n, size_t g) {
+    return (n >= 2) && (n <= TORNEO_MAX_SQUADRE) && (g < ordine(n));
+}
+
+/********************************************************************************/
+// Funzioni esportate
+/********************************************************************************/
+
+size_t Torneo_giornate(size_t n) {
+    return (n < 2) ? 0 : ordine(n);
+}
+
+uint32_t Torneo_avversario(size_t n, size_t g, size_t s) {
+    const size_t m = ordine(n);
+    size_t x;
+
+    if (!convalida(n, g) || (s >= n)) {
+        return TORNEO_RIPOSO;
+    }
+    if (s == m) {
+        return (uint32_t)g;         // Il "polo" (n pari)
+    }
+    if (s == g) {
+        return (m < n) ? (uint32_t)m : TORNEO_RIPOSO;
+    }
+
+    // 2g - s (mod m), con g, s < m: una sola correzione per lato
+    x = 2 * g;
+    if (x >= m) x -= m;
+    return (uint32_t)((x >= s) ? x - s : x + m - s);
+}
+
+size_t Torneo_giornata_di(size_t n, size_t i, size_t j) {
+    const size_t m = ordine(n);
+    size_t x;
+
+    if ((n < 2) || (i >= n) || (j >= n) || (i == j)) {
+        return SIZE_MAX;
+    }
+    if (i == m) {
+        return j;
+    }
+    if (j == m) {
+        return i;
+    }
+
+    // g = (i + j) / 2 (mod m): se i + j e' dispari si somma m
+    x = i + j;
+    if (x >= m) x -= m;
+    return (x & 1) ? (x + m) >> 1 : x >> 1;
+}
+
+size_t Torneo_giornata(size_t n, size_t g, Incontro_t* inc) {
+    const size_t m = ordine(n);
+    size_t c = 0;
+    uint32_t a, b;
+
+    if (!convalida(n, g)) {
+        return 0;
+    }
+    if (m < n) {
+        inc[c].a = (uint32_t)g;
+        inc[c].b = (uint32_t)m;
+        ++c;
+    }
+
+    // {g - t, g + t} (mod m), con riduzione per confronto
+    a = (uint32_t)g;
+    b = (uint32_t)g;
+    for (size_t t = 1; t <= (m >> 1); ++t) {
+        a = (0 == a) ? (uint32_t)m - 1 : a - 1;
+        b = (b + 1 == m) ? 0 : b + 1;
+        inc[c].a = (a < b) ? a : b;
+        inc[c].b = (a < b) ? b : a;
+        ++c;
+    }
+    return c;
+}
+
+bool Torneo_scrivi(size_t n, const char* nome) {
+    TorneoHeader h;
+    Incontro_t* inc;
+    FILE* fp;
+    bool ok;
+
+    if (!convalida(n, 0)) {
+        fprintf(stderr, ">> LIB_STS.Torneo_scrivi(): ERRORE\n"
+                ">>    Numero di squadre non valido: %zu\n\n", n);
+        return false;
+    }
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, TORNEO_MAGIC, sizeof(h.magic));
+    h.versione = TORNEO_VERSIONE;
+    h.n        = (uint32_t)n;
+    h.giornate = (uint32_t)Torneo_giornate(n);
+    h.incontri = (uint32_t)(n >> 1);
+    h.totale   = (uint64_t)h.giornate * h.incontri;
+
+    inc = (Incontro_t*)malloc((n >> 1) * sizeof(Incontro_t));
+    if (NULL == inc) {
+        fputs("Errore di allocazione!\n", stderr);
+        return false;
+    }
+    fp = fopen(nome, "wb");
+    if (NULL == fp) {
+        fprintf(stderr, ">> LIB_STS.Torneo_scrivi(): ERRORE\n"
+                ">>    Impossibile creare il file %s\n\n", nome);
+        free(inc);
+        return false;
+    }
+
+    ok = (1 == fwrite(&h, sizeof(h), 1, fp));
+    for (size_t g = 0; ok && (g < h.giornate); ++g) {
+        size_t c = Torneo_giornata(n, g, inc);
+        ok = (c == fwrite(inc, sizeof(Incontro_t), c, fp));
+    }
+    ok = (0 == fclose(fp)) && ok;
+    free(inc);
+    if (!ok) {
+        fprintf(stderr, ">> LIB_STS.Torneo_scrivi(): ERRORE\n"
+                ">>    Scrittura fallita su %s\n\n", nome);
+        remove(nome);
+    }
+    return ok;
+}
+/************************************************************/
+/************************************************************/
+
+#if defined(TORNEO_TEST)
+#define QLCI_LIB
+#include "QLCI.c"
+
+/*
+** Confronto con il QLCI di ordine m costruito da genera_qlci(): fuori
+** diagonale la cella (i, j) e' la giornata di i contro j, contata da uno,
+** sulla diagonale la giornata in cui i riposa (o incontra il polo n - 1
+** se n e' pari). Segue la verifica a forza bruta del calendario.
+*/
+static bool verifica(size_t n) {
+    const size_t m = ordine(n), G = Torneo_giornate(n);
+    uint8_t* visto = (uint8_t*)calloc(n * n, 1);
+    Incontro_t* inc = (Incontro_t*)malloc((n / 2 + 1) * sizeof(Incontro_t));
+    uint8_t* gioca = (uint8_t*)malloc(n);
+    QLCI_t q = {0, NULL};
+    bool ok = (NULL != visto) && (NULL != inc) && (NULL != gioca) && crea_qlci(&q, m);
+
+    if (ok) {
+        genera_qlci(&q);
+    }
+    for (size_t i = 0; ok && (i < m); ++i) {
+        const uint32_t polo = (m == n) ? TORNEO_RIPOSO : (uint32_t)(n - 1);
+        ok = (Torneo_avversario(n, cella_qlci(&q, i, i) - 1, i) == polo);
+        for (size_t j = 0; ok && (j < m); ++j) {
+            ok = (i == j) || (Torneo_giornata_di(n, i, j) + 1 == cella_qlci(&q, i, j));
+        }
+    }
+    libera_qlci(&q);
+
+    for (size_t g = 0; ok && (g < G); ++g) {
+        size_t c = Torneo_giornata(n, g, inc);
+        ok = (c == n / 2);
+        memset(gioca, 0, n);
+        for (size_t t = 0; ok && (t < c); ++t) {
+            const uint32_t a = inc[t].a, b = inc[t].b;
+            ok = (a < b) && (b < n) && !gioca[a] && !gioca[b] && !visto[a * n + b] &&
+                 (Torneo_avversario(n, g, a) == b) && (Torneo_avversario(n, g, b) == a) &&
+                 (Torneo_giornata_di(n, a, b) == g) && (Torneo_giornata_di(n, b, a) == g);
+            gioca[a] = gioca[b] = visto[a * n + b] = 1;
+        }
+        for (size_t s = 0; ok && (s < n); ++s) {
+            ok = gioca[s] || (Torneo_avversario(n, g, s) == TORNEO_RIPOSO);
+        }
+    }
+    for (size_t a = 0; ok && (a < n); ++a) {
+        for (size_t b = a + 1; ok && (b < n); ++b) {
+            ok = visto[a * n + b];
+        }
+    }
+
+    free(visto);
+    free(inc);
+    free(gioca);
+    return ok;
+}
+
+int main() {
+    const char* nome = "torneo_test.bin";
+    size_t fallimenti = 0;
+    TorneoHeader h;
+    Incontro_t x;
+    FILE* fp;
+    bool ok;
+
+    for (size_t n = 2; n <= 200; ++n) {
+        if (!verifica(n)) {
+            printf("** Calendario per %zu squadre ERRATO\n", n);
+            ++fallimenti;
+        }
+    }
+    printf("** Calendari per 2..200 squadre verificati: %zu errori\n", fallimenti);
+
+    // Round-trip su file: header e ultimo incontro
+    ok = Torneo_scrivi(21, nome) && (NULL != (fp = fopen(nome, "rb")));
+    if (ok) {
+        ok = (1 == fread(&h, sizeof(h), 1, fp)) && !memcmp(h.magic, TORNEO_MAGIC, 4) &&
+             (21 == h.n) && (21 == h.giornate) && (10 == h.incontri) && (210 == h.totale) &&
+             (0 == fseek(fp, (long)(sizeof(h) + (h.totale - 1) * sizeof(x)), SEEK_SET)) &&
+             (1 == fread(&x, sizeof(x), 1, fp)) && (Torneo_giornata_di(21, x.a, x.b) == 20);
+        fclose(fp);
+        remove(nome);
+    }
+    printf("** Round-trip su file: %s\n", ok ? "OK" : "ERRATO");
+    fallimenti += !ok;
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#elif defined(TORNEO_BENCH)
+#include <time.h>
+
+/*
+** Benchmark: generazione completa dei calendari con checksum, accesso
+** casuale O(1) e scrittura su file binario.
+*/
+int main() {
+    static const size_t N[] = {1001, 10000, 31623, 100000};
+    const char* nome = "torneo_bench.bin";
+
+    printf("%8s %14s %10s %12s\n", "n", "incontri", "sec", "Mincontri/s");
+    for (size_t q = 0; q < sizeof(N) / sizeof(N[0]); ++q) {
+        const size_t n = N[q], G = Torneo_giornate(n);
+        Incontro_t* inc = (Incontro_t*)malloc((n / 2) * sizeof(Incontro_t));
+        uint64_t tot = 0, chk = 0;
+        clock_t t0 = clock();
+        double s;
+
+        if (NULL == inc) {
+            fputs("Errore di allocazione!\n", stderr);
+            return EXIT_FAILURE;
+        }
+        for (size_t g = 0; g < G; ++g) {
+            size_t c = Torneo_giornata(n, g, inc);
+            for (size_t t = 0; t < c; ++t) {
+                chk += (uint64_t)inc[t].a * 31 + inc[t].b;
+            }
+            tot += c;
+        }
+        s = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("%8zu %14llu %10.3f %12.1f   (checksum %llx)\n", n, (unsigned long long)tot,
+               s, tot / (s > 0 ? s : 1e-9) / 1e6, (unsigned long long)chk);
+        free(inc);
+    }
+
+    {
+        const size_t n = 100000;
+        uint64_t chk = 0;
+        uint32_t x = 12345;
+        clock_t t0 = clock();
+        double s;
+
+        for (size_t r = 0; r < 100000000; ++r) {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            chk += Torneo_avversario(n, x % (n - 1), (x >> 7) % n);
+        }
+        s = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("\nAccesso casuale (n = %zu): 10^8 Torneo_avversario() in %.3f s (checksum %llx)\n",
+               n, s, (unsigned long long)chk);
+    }
+
+    {
+        const size_t n = 5001;
+        clock_t t0 = clock();
+        double s;
+        bool ok = Torneo_scrivi(n, nome);
+
+        s = (double)(clock() - t0) / CLOCKS_PER_SEC;
+        printf("Scrittura binaria (n = %zu, %.1f MB): %s in %.3f s\n", n,
+               (32.0 + (double)n * (n / 2) * sizeof(Incontro_t)) / 1048576.0,
+               ok ? "OK" : "ERRORE", s);
+        remove(nome);
+    }
+    return EXIT_SUCCESS;
+}
+#endif
+/** EOF: Torneo.c **/
@@ -0,0 +1,145 @@
+/************************************************************************/
+/* Generatore delle tabelle costanti di STSC_piccoli.h: per ogni v
+** ammissibile fino al limite indicato, le terne dello STS ciclico gia'
+** completamente sviluppate, nello stesso ordine di Genera_STSC().
+**
+** La libreria va compilata con STSC_NO_PICCOLI, dato che la tabella
+** da rigenerare potrebbe non esistere o essere obsoleta:
+**
+**   gcc -std=c99 -O2 -DSTSC_NO_PICCOLI -I../Include gen_piccoli.c STSC.c
+**       -o gen_piccoli
+**   ./gen_piccoli 63 > ../Include/STSC_piccoli.h
+**
+** Compilare abilitando il simbolo PICCOLI_TEST (con la libreria normale)
+** per confrontare le tabelle con lo sviluppo delle terne differenza e
+** misurare il percorso rapido di STSC_precalcolato().
+**
+** Licenza: MIT License
+** Copyright (C) 2000-2025 M.A.W. 1968
+*/
+/************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "STSC.h"
+
+// Limite per difetto: copre tutti i casi precalcolati di Peltesohn.h
+#define PICCOLI_MAX 63
+
+#if defined(PICCOLI_TEST)
+#include <time.h>
+
+int main() {
+    const size_t R = 1000000;
+    Terna_t STS[700];
+    size_t fallimenti = 0, b, chk = 0;
+    clock_t t0;
+    double t_svi, t_gen, t_ptr;
+
+    for (size_t v = 0; v <= 2 * PICCOLI_MAX; ++v) {
+        const Terna_t* T = STSC_precalcolato(v, &b);
+        size_t td, atteso = 0;
+        Terna_t* TD;
+
+        if ((v <= PICCOLI_MAX) && Convalida_v(v)) {
+            TD = Genera_terne_differenza(v, &td);
+            atteso = Genera_STSC_da_terne(v, TD, td, STS);
+        }
+        if ((b != atteso) || ((NULL == T) != (0 == atteso)) ||
+            ((NULL != T) && memcmp(T, STS, b * sizeof(Terna_t)))) {
+            printf("** v = %zu: tabella ERRATA\n", v);
+            ++fallimenti;
+        }
+    }
+    printf("** Tabelle per v <= %u verificate: %zu errori\n", PICCOLI_MAX, fallimenti);
+
+    // Ciclo tipico di un job Monte Carlo sui piccoli ordini
+    t0 = clock();
+    for (size_t r = 0; r < R; ++r) {
+        size_t v = (r & 1) ? 45 : 63, td;
+        Terna_t* TD = Genera_terne_differenza(v, &td);
+        b = Genera_STSC_da_terne(v, TD, td, STS);
+        chk += STS[r % b].c;
+    }
+    t_svi = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    for (size_t r = 0; r < R; ++r) {
+        b = Genera_STSC((r & 1) ? 45 : 63, STS);
+        chk -= STS[r % b].c;
+    }
+    t_gen = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    t0 = clock();
+    for (size_t r = 0; r < R; ++r) {
+        const Terna_t* T = STSC_precalcolato((r & 1) ? 45 : 63, &b);
+        chk += T[r % b].c;
+    }
+    t_ptr = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    printf("%zu STS(45)/STS(63):\n", R);
+    printf("  sviluppo delle terne differenza: %.3f s\n", t_svi);
+    printf("  Genera_STSC() (copia tabella)..: %.3f s\n", t_gen);
+    printf("  STSC_precalcolato()............: %.3f s (checksum %zu)\n", t_ptr, chk);
+
+    return fallimenti ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+#else
+int main(int argc, char** argv) {
+    size_t max = (argc > 1) ? strtoul(argv[1], NULL, 10) : PICCOLI_MAX;
+    Terna_t* STS;
+
+    if ((max < 7) || (max > 255)) {
+        fprintf(stderr, "Limite non valido: %zu (7..255)\n", max);
+        return EXIT_FAILURE;
+    }
+    STS = (Terna_t*)malloc(Totale_terne_STS(max) * sizeof(Terna_t));
+    if (NULL == STS) {
+        fputs("Errore di allocazione!\n", stderr);
+        return EXIT_FAILURE;
+    }
+
+    printf("#ifndef _STSC_PICCOLI_H_\n #define _STSC_PICCOLI_H_\n\n");
+    printf("// File generato da gen_piccoli.c: NON modificare manualmente.\n");
+    printf("// STS ciclici completamente sviluppati per v <= STSC_PICCOLI_MAX,\n");
+    printf("// nello stesso ordine di Genera_STSC().\n\n");
+    printf("#define STSC_PICCOLI_MAX     %zuU\n", max);
+    printf("#define STSC_PICCOLI_VERSION 0x%04XU\n\n", STSC_LIB_VERSION);
+
+    for (size_t v = 7; v <= max; ++v) {
+        size_t b;
+        if (!Convalida_v(v)) {
+            continue;
+        }
+        b = Genera_STSC(v, STS);
+        if (b != Totale_terne_STS(v)) {
+            fprintf(stderr, "Generazione fallita per v = %zu\n", v);
+            free(STS);
+            return EXIT_FAILURE;
+        }
+        printf("static const Terna_t STS_V%03zu[%zu] = {\n", v, b);
+        for (size_t i = 0; i < b; ++i) {
+            printf("%s{%u,%u,%u}%s", (0 == i % 8) ? "    " : " ",
+                   STS[i].a, STS[i].b, STS[i].c,
+                   (i + 1 == b) ? "\n" : ((7 == i % 8) ? ",\n" : ","));
+        }
+        printf("};\n\n");
+    }
+
+    printf("typedef struct {\n    const Terna_t* terne;\n    uint32_t       b;\n} STSC_piccolo_t;\n\n");
+    printf("// Tabella di dispatch ad accesso diretto, indicizzata da v\n");
+    printf("static const STSC_piccolo_t STSC_PICCOLI[STSC_PICCOLI_MAX + 1] = {\n");
+    for (size_t v = 7; v <= max; ++v) {
+        if (Convalida_v(v)) {
+            printf("    [%zu] = {STS_V%03zu, %zuU},\n", v, v, Totale_terne_STS(v));
+        }
+    }
+    printf("};\n#endif\n");
+
+    free(STS);
+    return EXIT_SUCCESS;
+}
+#endif
+/** EOF: gen_piccoli.c **/
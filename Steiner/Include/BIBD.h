@@ -0,0 +1,128 @@
+#ifndef _LIB_BIBD_H_
+ #define _LIB_BIBD_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Dimensioni di blocco supportate
+#define BIBD_K_MIN 3U
+#define BIBD_K_MAX 5U
+
+// Cache su disco delle famiglie, condivisa con STSC_gen (STSC_CACHE_DIR)
+#define DF_CACHE_DIR "STSC_cache"
+#define DF_CACHE_ENV "STSC_CACHE_DIR"
+
+// Budget di nodi per difetto della ricerca (circa 10^8 nodi al secondo)
+#define DF_MAX_NODI 2000000000ULL
+
+/*
+** Famiglia di differenze ciclica (v,k,1): nb blocchi base di k elementi,
+** ciascuno con primo elemento 0, piu' l'eventuale orbita corta
+** {0, v/k, 2v/k, ...} se v = k (mod k(k-1)).
+*/
+typedef struct {
+    uint32_t  v;
+    uint32_t  k;
+    uint32_t  nb;           // Blocchi base delle orbite complete
+    bool      corta;        // Presenza dell'orbita corta
+    uint32_t* base;         // nb * k elementi
+    uint64_t  nodi;         // Nodi visitati dalla ricerca (0 se da cache)
+} Famiglia_t;
+
+/********************************************************************************/
+/*
+** Convalida_BIBD()
+**
+** Scopo:
+**   - Condizione necessaria per un (v,k,1)-BIBD ciclico sviluppato da una
+**     famiglia di differenze: v = 1 oppure v = k (mod k(k-1)), v > k.
+**     Non e' sufficiente: ad esempio non esistono (9,3,1) e (25,4,1) ciclici.
+*/
+/********************************************************************************/
+bool Convalida_BIBD(size_t v, size_t k);
+
+/********************************************************************************/
+/*
+** Totale_blocchi_BIBD()
+**
+** Scopo:
+**   - Calcola il numero di blocchi b = v(v-1) / (k(k-1)).
+*/
+/********************************************************************************/
+size_t Totale_blocchi_BIBD(size_t v, size_t k);
+
+/********************************************************************************/
+/*
+** Cerca_famiglia()
+**
+** Scopo:
+**   - Cerca con backtracking una famiglia di differenze ciclica (v,k,1).
+**   - Le differenze usate sono tenute in una maschera di bit su Z_v.
+**     Rottura delle simmetrie: ogni nuovo blocco copre la minima
+**     differenza non ancora coperta d ed e' traslato nella forma
+**     {0, d, y1 < y2 < ...}, unica per ogni blocco della famiglia.
+**   - Ripartenze con budget crescente e ordine pseudocasuale dei candidati
+**     (deterministico): evitano che la ricerca resti bloccata nei
+**     sottoalberi sterili delle prime scelte.
+**   - Per v primo si tenta prima la costruzione radicale di Wilson, che
+**     richiede la ricerca di un solo blocco base.
+**
+** Parametri:
+**   - size_t v, k.......: Parametri del disegno.
+**   - uint64_t max_nodi.: Budget di nodi (0 = DF_MAX_NODI).
+**   - Famiglia_t* f.....: Famiglia trovata, da liberare con Libera_famiglia().
+**
+** Valore restituito:
+**   - bool: false se la famiglia non esiste o il budget e' esaurito.
+*/
+/********************************************************************************/
+bool Cerca_famiglia(size_t v, size_t k, uint64_t max_nodi, Famiglia_t* f);
+
+/********************************************************************************/
+/*
+** Famiglia_differenze()
+**
+** Scopo:
+**   - Come Cerca_famiglia(), ma consulta prima la cache su disco: ogni
+**     ordine viene cercato una sola volta. Le famiglie lette dalla cache
+**     vengono sempre riconvalidate. Anche l'esaurimento del budget
+**     DF_MAX_NODI viene registrato, cosi' che gli ordini senza famiglia
+**     nota non ripetano la ricerca; il record e' ignorato se il budget
+**     viene aumentato.
+*/
+/********************************************************************************/
+bool Famiglia_differenze(size_t v, size_t k, Famiglia_t* f);
+
+/********************************************************************************/
+/*
+** Convalida_famiglia()
+**
+** Scopo:
+**   - Verifica che ogni differenza non nulla di Z_v (escluse quelle
+**     dell'orbita corta) compaia esattamente una volta.
+*/
+/********************************************************************************/
+bool Convalida_famiglia(const Famiglia_t* f);
+
+/********************************************************************************/
+/*
+** Sviluppa_famiglia()
+**
+** Scopo:
+**   - Kernel di sviluppo ciclico generalizzato, derivato da Genera_STSC():
+**     ogni blocco base viene traslato v volte, l'orbita corta v/k volte.
+**     Il modulo e' sostituito da un confronto, come nella versione parallela.
+**
+** Parametri:
+**   - const Famiglia_t* f.: La famiglia di differenze.
+**   - uint32_t* blocchi...: Array di Totale_blocchi_BIBD(v,k) * k elementi,
+**                           allocato a carico del chiamante.
+**
+** Valore restituito:
+**   - size_t: numero di blocchi generati.
+*/
+/********************************************************************************/
+size_t Sviluppa_famiglia(const Famiglia_t* f, uint32_t* blocchi);
+
+void Libera_famiglia(Famiglia_t* f);
+#endif
@@ -0,0 +1,120 @@
+#ifndef _LIB_SQS_H_
+ #define _LIB_SQS_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "STSC.h"
+
+// Struttura per una quaterna (blocco di un SQS), elementi non ordinati
+typedef struct {
+    uint32_t a, b, c, d;
+} Quaterna_t;
+
+/*
+** Sink per la generazione in streaming: riceve una quaterna alla volta.
+** Restituendo false il sink interrompe la generazione.
+*/
+typedef bool (*SQS_sink_t)(const Quaterna_t* q, void* ctx);
+
+// Stato del verificatore di copertura delle terne (un bit per terna)
+typedef struct {
+    size_t    v;            // Ordine del SQS
+    size_t    quaterne;     // Quaterne ricevute
+    size_t    errori;       // Terne coperte piu' volte, punti non validi
+    uint64_t* bitmap;       // Bitset di C(v,3) bit, indicizzato in colex
+} SQS_verifica_t;
+
+/********************************************************************************/
+/*
+** Convalida_SQS()
+**
+** Scopo:
+**   - Condizione necessaria e sufficiente di esistenza di un sistema
+**     quadruplo di Steiner: v = 2 oppure 4 (mod 6), v >= 4.
+**
+** Parametri:
+**   - size_t v: dimensione del SQS.
+**
+** Valore restituito:
+**   - bool: true se il parametro risulta congruente.
+*/
+/********************************************************************************/
+bool Convalida_SQS(size_t v);
+
+/********************************************************************************/
+/*
+** Totale_quaterne_SQS()
+**
+** Scopo:
+**   - Calcola il numero di quaterne b = v(v-1)(v-2)/24 di un SQS(v).
+**
+** Parametri:
+**   - size_t v: dimensione del SQS.
+**
+** Valore restituito:
+**   - size_t: Numero di quaterne attese.
+*/
+/********************************************************************************/
+size_t Totale_quaterne_SQS(size_t v);
+
+/********************************************************************************/
+/*
+** SQS_costruibile()
+**
+** Scopo:
+**   - Indica se v e' raggiungibile con le costruzioni della libreria:
+**     un seme tabulato, seguito da una catena di raddoppi v -> 2v e di
+**     triplicazioni v -> 3v - 2. Gli ordini che richiedono le altre
+**     costruzioni di Hanani (3v - 8, 4v - 6, 12v - 10) non sono coperti:
+**     i primi sono 34, 38, 50, 62, 68, 70, 74.
+**
+** Parametri:
+**   - size_t v: dimensione del SQS.
+**
+** Valore restituito:
+**   - bool: true se Genera_SQS() e' in grado di produrre SQS(v).
+*/
+/********************************************************************************/
+bool SQS_costruibile(size_t v);
+
+/********************************************************************************/
+/*
+** Genera_SQS()
+**
+** Scopo:
+**   - Genera un sistema quadruplo di Steiner SQS(v) in streaming: ogni
+**     quaterna viene passata al sink appena prodotta, senza mai
+**     memorizzare l'intero sistema (b cresce come v^3).
+**   - Costruzioni: estensione 1-rotazionale di uno STS(v-1) ciclico
+**     prodotto da Genera_STSC(), con quaterne base tabulate, seguita
+**     da raddoppi SQS(v) -> SQS(2v) e triplicazioni SQS(v) -> SQS(3v-2).
+**   - Per gli ordini non costruibili (vedi SQS_costruibile()) non
+**     emette nulla e restituisce 0.
+**
+** Parametri:
+**   - size_t v........: La dimensione del SQS, della forma 6n+2 oppure 6n+4.
+**   - SQS_sink_t sink.: Funzione che riceve le quaterne.
+**   - void* ctx.......: Contesto opaco passato al sink.
+**
+** Valore restituito:
+**   - size_t: 0 in caso d'errore (anche un'allocazione fallita durante
+**     la costruzione), altrimenti il numero di quaterne emesse (inferiore
+**     a Totale_quaterne_SQS(v) se il sink ha interrotto).
+*/
+/********************************************************************************/
+size_t Genera_SQS(size_t v, SQS_sink_t sink, void* ctx);
+
+/********************************************************************************/
+/*
+** Verificatore a bitset: si inizializza con SQS_verifica_init(), si passa
+** SQS_verifica_sink() come sink a Genera_SQS() (o a qualunque altra
+** sorgente di quaterne) e si legge l'esito con SQS_verifica_esito().
+** Ogni terna di punti deve risultare coperta esattamente una volta.
+** Memoria: C(v,3)/8 byte.
+*/
+/********************************************************************************/
+bool SQS_verifica_init(SQS_verifica_t* vf, size_t v);
+bool SQS_verifica_sink(const Quaterna_t* q, void* ctx);
+bool SQS_verifica_esito(const SQS_verifica_t* vf);
+void SQS_verifica_libera(SQS_verifica_t* vf);
+#endif
@@ -0,0 +1,128 @@
+#ifndef _SQS_seed_h_
+ #define _SQS_seed_h_
+
+/*
+** Semi per la costruzione dei SQS. Ad eccezione di SQS(4) e SQS(10), ogni
+** seme e' l'estensione SQS(v+1) di uno STS(v) ciclico prodotto da
+** Genera_STSC(): le terne T dello STS, completate dal punto all'infinito
+** v, danno le quaterne T + {v}; le restanti quaterne coprono le terne di
+** Z_v non contenute nello STS.
+** Per i semi 1-rotazionali sono tabulate le sole quaterne base, da
+** sviluppare modulo v come in Genera_STSC(). Per v = 13 non esiste una
+** tale estensione dello STS(13) ciclico e le quaterne sono elencate tutte.
+**
+** Le tabelle sono state ottenute per ricerca esaustiva (exact cover sulle
+** orbite delle terne) e vengono comunque convalidate dal self-test.
+*/
+
+typedef struct {
+    uint32_t v;              // Ordine del SQS
+    uint32_t v_sts;          // Ordine dello STS ciclico esteso (0 se assente)
+    uint32_t nq;             // Quaterne tabulate
+    bool     sviluppo;       // true: quaterne base da sviluppare modulo v_sts
+    const Quaterna_t* q;
+} SQS_seme_t;
+
+static const Quaterna_t SQS_Q4[] = {
+    {0, 1, 2, 3},
+};
+
+static const Quaterna_t SQS_Q10[] = {
+    {0, 1, 2, 8}, {0, 1, 3, 4}, {0, 1, 5, 7}, {0, 1, 6, 9}, {0, 2, 3, 9}, {0, 2, 4, 5},
+    {0, 2, 6, 7}, {0, 3, 5, 6}, {0, 3, 7, 8}, {0, 4, 6, 8}, {0, 4, 7, 9}, {0, 5, 8, 9},
+    {1, 2, 3, 5}, {1, 2, 4, 6}, {1, 2, 7, 9}, {1, 3, 6, 7}, {1, 3, 8, 9}, {1, 4, 5, 9},
+    {1, 4, 7, 8}, {1, 5, 6, 8}, {2, 3, 4, 7}, {2, 3, 6, 8}, {2, 4, 8, 9}, {2, 5, 6, 9},
+    {2, 5, 7, 8}, {3, 4, 5, 8}, {3, 4, 6, 9}, {3, 5, 7, 9}, {4, 5, 6, 7}, {6, 7, 8, 9},
+};
+
+static const Quaterna_t SQS_R13[] = {
+    {0, 1, 2, 8}, {0, 1, 3, 7}, {0, 1, 5, 6}, {0, 1, 9, 11}, {0, 1, 10, 12}, {0, 2, 3, 9},
+    {0, 2, 4, 6}, {0, 2, 5, 12}, {0, 2, 10, 11}, {0, 3, 4, 11}, {0, 3, 5, 8}, {0, 3, 6, 10},
+    {0, 4, 5, 10}, {0, 4, 7, 12}, {0, 4, 8, 9}, {0, 5, 7, 9}, {0, 6, 7, 11}, {0, 6, 9, 12},
+    {0, 7, 8, 10}, {0, 8, 11, 12}, {1, 2, 3, 10}, {1, 2, 4, 11}, {1, 2, 6, 7}, {1, 2, 9, 12},
+    {1, 3, 4, 12}, {1, 3, 5, 11}, {1, 3, 6, 9}, {1, 4, 5, 9}, {1, 4, 6, 10}, {1, 4, 7, 8},
+    {1, 5, 7, 10}, {1, 5, 8, 12}, {1, 6, 8, 11}, {1, 7, 11, 12}, {1, 8, 9, 10}, {2, 3, 4, 5},
+    {2, 3, 7, 12}, {2, 3, 8, 11}, {2, 4, 7, 10}, {2, 4, 8, 12}, {2, 5, 6, 11}, {2, 5, 7, 8},
+    {2, 5, 9, 10}, {2, 6, 8, 9}, {2, 6, 10, 12}, {2, 7, 9, 11}, {3, 4, 6, 8}, {3, 4, 9, 10},
+    {3, 5, 6, 7}, {3, 5, 9, 12}, {3, 6, 11, 12}, {3, 7, 8, 9}, {3, 7, 10, 11}, {3, 8, 10, 12},
+    {4, 5, 6, 12}, {4, 5, 7, 11}, {4, 6, 7, 9}, {4, 8, 10, 11}, {4, 9, 11, 12}, {5, 6, 8, 10},
+    {5, 8, 9, 11}, {5, 10, 11, 12}, {6, 7, 8, 12}, {6, 9, 10, 11}, {7, 9, 10, 12},
+};
+
+static const Quaterna_t SQS_B07[] = {
+    {0, 1, 2, 5},
+};
+
+static const Quaterna_t SQS_B15[] = {
+    {0, 1, 2, 11}, {0, 1, 3, 7}, {0, 1, 8, 13}, {0, 1, 6, 12}, {0, 1, 5, 9}, {0, 2, 4, 7},
+    {0, 2, 9, 12},
+};
+
+static const Quaterna_t SQS_B19[] = {
+    {0, 1, 2, 17}, {0, 1, 3, 15}, {0, 1, 5, 9}, {0, 1, 4, 10}, {0, 1, 7, 11}, {0, 1, 8, 13},
+    {0, 1, 12, 14}, {0, 2, 11, 16}, {0, 3, 6, 11}, {0, 2, 5, 15}, {0, 2, 6, 13}, {0, 2, 9, 12},
+};
+
+static const Quaterna_t SQS_B21[] = {
+    {0, 2, 5, 11}, {0, 3, 6, 15}, {0, 1, 4, 6}, {0, 1, 3, 13}, {0, 4, 9, 13}, {0, 1, 11, 17},
+    {0, 3, 11, 16}, {0, 2, 8, 10}, {0, 1, 2, 19}, {0, 4, 8, 14}, {0, 1, 7, 8}, {0, 3, 7, 10},
+    {0, 1, 5, 12}, {0, 1, 9, 16}, {0, 2, 7, 9},
+};
+
+static const Quaterna_t SQS_B25[] = {
+    {0, 1, 2, 18}, {0, 1, 5, 7}, {0, 1, 3, 4}, {0, 1, 8, 19}, {0, 1, 14, 20}, {0, 1, 11, 21},
+    {0, 1, 10, 13}, {0, 1, 9, 16}, {0, 1, 6, 15}, {0, 3, 7, 19}, {0, 2, 5, 12}, {0, 2, 15, 22},
+    {0, 4, 9, 14}, {0, 2, 10, 19}, {0, 3, 9, 21}, {0, 2, 14, 17}, {0, 2, 13, 16}, {0, 2, 4, 8},
+    {0, 4, 12, 17}, {0, 3, 6, 20}, {0, 2, 7, 11}, {0, 4, 11, 19},
+};
+
+static const Quaterna_t SQS_B27[] = {
+    {0, 1, 2, 14}, {0, 2, 9, 15}, {0, 2, 7, 21}, {0, 2, 4, 19}, {0, 2, 8, 16}, {0, 2, 6, 12},
+    {0, 2, 10, 13}, {0, 2, 20, 23}, {0, 2, 5, 22}, {0, 2, 11, 18}, {0, 1, 22, 25}, {0, 1, 7, 8},
+    {0, 5, 13, 20}, {0, 1, 4, 11}, {0, 3, 14, 18}, {0, 1, 5, 24}, {0, 1, 12, 15}, {0, 4, 9, 22},
+    {0, 4, 12, 18}, {0, 3, 13, 23}, {0, 1, 17, 23}, {0, 3, 12, 22}, {0, 3, 11, 21}, {0, 1, 9, 10},
+    {0, 4, 15, 20}, {0, 1, 6, 16},
+};
+
+static const Quaterna_t SQS_B31[] = {
+    {0, 1, 2, 14}, {0, 1, 17, 27}, {0, 1, 12, 15}, {0, 1, 11, 20}, {0, 1, 6, 21}, {0, 1, 16, 25},
+    {0, 1, 22, 29}, {0, 1, 3, 10}, {0, 1, 4, 7}, {0, 1, 18, 24}, {0, 1, 23, 26}, {0, 1, 19, 28},
+    {0, 1, 5, 9}, {0, 4, 13, 18}, {0, 5, 14, 23}, {0, 2, 8, 17}, {0, 2, 19, 22}, {0, 3, 18, 25},
+    {0, 4, 9, 19}, {0, 5, 12, 19}, {0, 3, 7, 17}, {0, 5, 16, 24}, {0, 2, 13, 25}, {0, 4, 11, 24},
+    {0, 2, 21, 27}, {0, 2, 4, 12}, {0, 2, 6, 18}, {0, 5, 11, 25}, {0, 2, 16, 20}, {0, 2, 15, 23},
+    {0, 3, 11, 15}, {0, 2, 5, 7}, {0, 6, 16, 23}, {0, 3, 21, 26}, {0, 3, 13, 23},
+};
+
+/*
+** Ingrediente della costruzione 3v - 2: SQS(10) sui punti {oo} + Z_3 x {x,y,z}
+** privato delle tre quaterne verticali {oo,(0,t),(1,t),(2,t)}. Codifica
+** delle etichette: 0 = oo, 1 + 3t + i = (i,t) con t = 0, 1, 2 in luogo di
+** x, y, z. Le 27 quaterne coprono tutte e sole le terne non contenute in
+** una verticale.
+*/
+static const Quaterna_t SQS_T10[] = {
+    {0, 1, 4, 7}, {0, 1, 5, 8}, {0, 1, 6, 9}, {0, 2, 4, 9}, {0, 2, 5, 7}, {0, 2, 6, 8},
+    {0, 3, 4, 8}, {0, 3, 5, 9}, {0, 3, 6, 7}, {1, 2, 4, 5}, {1, 2, 6, 7}, {1, 2, 8, 9},
+    {1, 3, 4, 9}, {1, 3, 5, 6}, {1, 3, 7, 8}, {1, 4, 6, 8}, {1, 5, 7, 9}, {2, 3, 4, 6},
+    {2, 3, 5, 8}, {2, 3, 7, 9}, {2, 4, 7, 8}, {2, 5, 6, 9}, {3, 4, 5, 7}, {3, 6, 8, 9},
+    {4, 5, 8, 9}, {4, 6, 7, 9}, {5, 6, 7, 8},
+};
+
+#define MAX_T10 (sizeof(SQS_T10) / sizeof(SQS_T10[0]))
+
+// Semi ordinati per v crescente
+static const SQS_seme_t SQS_SEMI[] = {
+    { 4,  0,  1, false, SQS_Q4},
+    { 8,  7,  1, true,  SQS_B07},
+    {10,  0, 30, false, SQS_Q10},
+    {14, 13, 65, false, SQS_R13},
+    {16, 15,  7, true,  SQS_B15},
+    {20, 19, 12, true,  SQS_B19},
+    {22, 21, 15, true,  SQS_B21},
+    {26, 25, 22, true,  SQS_B25},
+    {28, 27, 26, true,  SQS_B27},
+    {32, 31, 35, true,  SQS_B31},
+};
+
+#define MAX_SEMI (sizeof(SQS_SEMI) / sizeof(SQS_SEMI[0]))
+#endif
@@ -4,6 +4,10 @@
 
 #define MOD(a, b) (((a) % (b) + (b)) % (b))
 
+// Versione della libreria: va incrementata ad ogni modifica che alteri
+// l'ordine o il contenuto delle terne generate (invalida le cache su disco)
+#define STSC_LIB_VERSION 0x0102U
+
 // Struttura per una terna
 typedef struct {
     uint32_t a, b, c;
@@ -29,6 +33,49 @@ typedef struct {
 /********************************************************************************/
 size_t Genera_STSC(size_t v, Terna_t* STSC);
 
+/********************************************************************************/
+/*
+** Genera_STSC_parallel()
+**
+** Scopo:
+**   - Variante multithread (OpenMP) di Genera_STSC(), con identico output.
+**     L'array viene partizionato staticamente tra i thread, spezzando
+**     anche le singole orbite: per sfruttare l'allocazione first-touch
+**     sui sistemi NUMA, allocare STSC con malloc() senza inizializzarlo.
+**
+** Parametri:
+**   - Size_t   v......: La dimensione del STSC, della forma 6n+1 oppure 6n+3.
+**   - Terna_t* STSC...: Puntatore all'array di terne, allocato a carico
+**                       del chiamante e dimensionato usando la funzione di 
+**                       libreria apposita totale_terne_STS(v).
+**
+** Valore restituito:
+**   - size_t: 0 in caso d'errore, oppure il numero di terne b del STSC(v).
+*/
+/********************************************************************************/
+size_t Genera_STSC_parallel(size_t v, Terna_t* STSC);
+
+/********************************************************************************/
+/*
+** Genera_STSC_da_terne()
+**
+** Scopo:
+**   - Sviluppa un insieme di terne differenza fornito dal chiamante (ad es.
+**     una soluzione di Cerca_terne_differenza()), previa convalida.
+**     L'ordine delle terne prodotte e' lo stesso di Genera_STSC().
+**
+** Parametri:
+**   - Size_t   v..........: La dimensione del STSC, della forma 6n+1 oppure 6n+3.
+**   - const Terna_t* TDiff: Le td terne differenza {a, b, c}.
+**   - size_t td...........: Numero di terne differenza, (v-1)/6 per difetto.
+**   - Terna_t* STSC.......: Array di Totale_terne_STS(v) terne.
+**
+** Valore restituito:
+**   - size_t: 0 in caso d'errore, oppure il numero di terne b del STSC(v).
+*/
+/********************************************************************************/
+size_t Genera_STSC_da_terne(size_t v, const Terna_t* TDiff, size_t td, Terna_t* STSC);
+
 /********************************************************************************/
 /*
 ** Genera_terne_differenza()
@@ -55,6 +102,26 @@ size_t Genera_STSC(size_t v, Terna_t* STSC);
 /********************************************************************************/
 Terna_t* Genera_terne_differenza(size_t v, size_t* td);
 
+/********************************************************************************/
+/*
+** STSC_precalcolato()
+**
+** Scopo:
+**   - Percorso rapido per i piccoli ordini (v <= STSC_PICCOLI_MAX, 63 per
+**     difetto): puntatore costante allo STS gia' sviluppato, con le terne
+**     nello stesso ordine di Genera_STSC(). Nessuna copia.
+**   - Le tabelle in STSC_piccoli.h sono generate da gen_piccoli.c.
+**
+** Parametri:
+**   - size_t v.: La dimensione del STSC.
+**   - size_t* b: Numero di terne restituite (0 se la tabella manca).
+**
+** Valore restituito:
+**   - const Terna_t*: NULL se v non e' nelle tabelle.
+*/
+/********************************************************************************/
+const Terna_t* STSC_precalcolato(size_t v, size_t* b);
+
 /************************************************************/
 /*
 ** Convalida_v()
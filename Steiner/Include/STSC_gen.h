@@ -32,6 +32,33 @@
 #define FILENAME  "STSC_%04zu.csv"
 #define FNAME_MAX 64
 
+/*
+** Cache persistente su disco dei STS generati (STSC_cache.c).
+** La directory e il limite di occupazione si possono ridefinire con le
+** variabili d'ambiente STSC_CACHE_DIR e STSC_CACHE_MB.
+*/
+#define CACHE_DIR       "STSC_cache"
+#define CACHE_MAX_MB    256U
+#define CACHE_PATH_MAX  260
+
+// Formati di payload delle voci in cache (parte della chiave)
+typedef enum {
+    CACHE_FMT_TERNE_U32 = 2   // Array di Terna_t, tre uint32_t nell'ordine di
+                              // byte dichiarato dall'header (1: header senza marca)
+} CacheFmt;
+
+// Descrittore di una voce di cache mappata in memoria
+typedef struct {
+    void*   base;       // Indirizzo della vista (header incluso)
+    size_t  size;       // Dimensione della vista in byte
+#ifdef _WIN32
+    void*   hfile;      // HANDLE del file
+    void*   hmap;       // HANDLE del file mapping
+#else
+    int     fd;
+#endif
+} CacheMap;
+
 /* 
 ** Limiti per v. Il limite superiore e' del tutto arbitrario.
 ** La libreria  precompilata per un massimo di 10000 terne differenza,
@@ -53,6 +80,7 @@ typedef struct {
     bool    print_flg;  // Gestisce la stampa a video
     bool    save_flg;   // Gestisce il salvataggio in un file CDF
     bool    diff_flg;   // Gestisce la stampa delle terne differenza
+    bool    cache_flg;  // Abilita la cache persistente su disco
     size_t  v;          // Dimensione del STS, se 1 si esce dal programma
     size_t  b;          // Parametro b del STS(v): totale blocchi (terne)
     size_t  total;      // Totalizzatore terne generate
@@ -63,6 +91,11 @@ extern SysParams sysparms;  // Variabile globale per la configurazione
 // Funzione di generazione (STSC_gen.c)
 bool genera_STS_ciclico(void);
 
+// Funzioni cache persistente (STSC_cache.c)
+const Terna_t* cache_apri(size_t v, size_t b, CacheMap* m);
+void cache_chiudi(CacheMap* m);
+bool cache_salva(size_t v, const Terna_t* STSC, size_t b);
+
 // Funzioni UI (STSC_UI.c)
 bool get_flag(const char *prompt, const bool deflt);
 bool prompt_user(void);
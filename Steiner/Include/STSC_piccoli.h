@@ -0,0 +1,722 @@
+#ifndef _STSC_PICCOLI_H_
+ #define _STSC_PICCOLI_H_
+
+// File generato da gen_piccoli.c: NON modificare manualmente.
+// STS ciclici completamente sviluppati per v <= STSC_PICCOLI_MAX,
+// nello stesso ordine di Genera_STSC().
+
+#define STSC_PICCOLI_MAX     63U
+#define STSC_PICCOLI_VERSION 0x0102U
+
+static const Terna_t STS_V007[7] = {
+    {0,1,3}, {1,2,4}, {2,3,5}, {3,4,6}, {4,5,0}, {5,6,1}, {6,0,2}
+};
+
+static const Terna_t STS_V013[26] = {
+    {0,1,4}, {1,2,5}, {2,3,6}, {3,4,7}, {4,5,8}, {5,6,9}, {6,7,10}, {7,8,11},
+    {8,9,12}, {9,10,0}, {10,11,1}, {11,12,2}, {12,0,3}, {0,2,7}, {1,3,8}, {2,4,9},
+    {3,5,10}, {4,6,11}, {5,7,12}, {6,8,0}, {7,9,1}, {8,10,2}, {9,11,3}, {10,12,4},
+    {11,0,5}, {12,1,6}
+};
+
+static const Terna_t STS_V015[35] = {
+    {0,1,4}, {1,2,5}, {2,3,6}, {3,4,7}, {4,5,8}, {5,6,9}, {6,7,10}, {7,8,11},
+    {8,9,12}, {9,10,13}, {10,11,14}, {11,12,0}, {12,13,1}, {13,14,2}, {14,0,3}, {0,2,8},
+    {1,3,9}, {2,4,10}, {3,5,11}, {4,6,12}, {5,7,13}, {6,8,14}, {7,9,0}, {8,10,1},
+    {9,11,2}, {10,12,3}, {11,13,4}, {12,14,5}, {13,0,6}, {14,1,7}, {0,5,10}, {1,6,11},
+    {2,7,12}, {3,8,13}, {4,9,14}
+};
+
+static const Terna_t STS_V019[57] = {
+    {0,1,6}, {1,2,7}, {2,3,8}, {3,4,9}, {4,5,10}, {5,6,11}, {6,7,12}, {7,8,13},
+    {8,9,14}, {9,10,15}, {10,11,16}, {11,12,17}, {12,13,18}, {13,14,0}, {14,15,1}, {15,16,2},
+    {16,17,3}, {17,18,4}, {18,0,5}, {0,2,10}, {1,3,11}, {2,4,12}, {3,5,13}, {4,6,14},
+    {5,7,15}, {6,8,16}, {7,9,17}, {8,10,18}, {9,11,0}, {10,12,1}, {11,13,2}, {12,14,3},
+    {13,15,4}, {14,16,5}, {15,17,6}, {16,18,7}, {17,0,8}, {18,1,9}, {0,3,7}, {1,4,8},
+    {2,5,9}, {3,6,10}, {4,7,11}, {5,8,12}, {6,9,13}, {7,10,14}, {8,11,15}, {9,12,16},
+    {10,13,17}, {11,14,18}, {12,15,0}, {13,16,1}, {14,17,2}, {15,18,3}, {16,0,4}, {17,1,5},
+    {18,2,6}
+};
+
+static const Terna_t STS_V021[70] = {
+    {0,1,10}, {1,2,11}, {2,3,12}, {3,4,13}, {4,5,14}, {5,6,15}, {6,7,16}, {7,8,17},
+    {8,9,18}, {9,10,19}, {10,11,20}, {11,12,0}, {12,13,1}, {13,14,2}, {14,15,3}, {15,16,4},
+    {16,17,5}, {17,18,6}, {18,19,7}, {19,20,8}, {20,0,9}, {0,2,6}, {1,3,7}, {2,4,8},
+    {3,5,9}, {4,6,10}, {5,7,11}, {6,8,12}, {7,9,13}, {8,10,14}, {9,11,15}, {10,12,16},
+    {11,13,17}, {12,14,18}, {13,15,19}, {14,16,20}, {15,17,0}, {16,18,1}, {17,19,2}, {18,20,3},
+    {19,0,4}, {20,1,5}, {0,3,8}, {1,4,9}, {2,5,10}, {3,6,11}, {4,7,12}, {5,8,13},
+    {6,9,14}, {7,10,15}, {8,11,16}, {9,12,17}, {10,13,18}, {11,14,19}, {12,15,20}, {13,16,0},
+    {14,17,1}, {15,18,2}, {16,19,3}, {17,20,4}, {18,0,5}, {19,1,6}, {20,2,7}, {0,7,14},
+    {1,8,15}, {2,9,16}, {3,10,17}, {4,11,18}, {5,12,19}, {6,13,20}
+};
+
+static const Terna_t STS_V025[100] = {
+    {0,4,10}, {1,5,11}, {2,6,12}, {3,7,13}, {4,8,14}, {5,9,15}, {6,10,16}, {7,11,17},
+    {8,12,18}, {9,13,19}, {10,14,20}, {11,15,21}, {12,16,22}, {13,17,23}, {14,18,24}, {15,19,0},
+    {16,20,1}, {17,21,2}, {18,22,3}, {19,23,4}, {20,24,5}, {21,0,6}, {22,1,7}, {23,2,8},
+    {24,3,9}, {0,1,12}, {1,2,13}, {2,3,14}, {3,4,15}, {4,5,16}, {5,6,17}, {6,7,18},
+    {7,8,19}, {8,9,20}, {9,10,21}, {10,11,22}, {11,12,23}, {12,13,24}, {13,14,0}, {14,15,1},
+    {15,16,2}, {16,17,3}, {17,18,4}, {18,19,5}, {19,20,6}, {20,21,7}, {21,22,8}, {22,23,9},
+    {23,24,10}, {24,0,11}, {0,2,9}, {1,3,10}, {2,4,11}, {3,5,12}, {4,6,13}, {5,7,14},
+    {6,8,15}, {7,9,16}, {8,10,17}, {9,11,18}, {10,12,19}, {11,13,20}, {12,14,21}, {13,15,22},
+    {14,16,23}, {15,17,24}, {16,18,0}, {17,19,1}, {18,20,2}, {19,21,3}, {20,22,4}, {21,23,5},
+    {22,24,6}, {23,0,7}, {24,1,8}, {0,3,8}, {1,4,9}, {2,5,10}, {3,6,11}, {4,7,12},
+    {5,8,13}, {6,9,14}, {7,10,15}, {8,11,16}, {9,12,17}, {10,13,18}, {11,14,19}, {12,15,20},
+    {13,16,21}, {14,17,22}, {15,18,23}, {16,19,24}, {17,20,0}, {18,21,1}, {19,22,2}, {20,23,3},
+    {21,24,4}, {22,0,5}, {23,1,6}, {24,2,7}
+};
+
+static const Terna_t STS_V027[117] = {
+    {0,1,3}, {1,2,4}, {2,3,5}, {3,4,6}, {4,5,7}, {5,6,8}, {6,7,9}, {7,8,10},
+    {8,9,11}, {9,10,12}, {10,11,13}, {11,12,14}, {12,13,15}, {13,14,16}, {14,15,17}, {15,16,18},
+    {16,17,19}, {17,18,20}, {18,19,21}, {19,20,22}, {20,21,23}, {21,22,24}, {22,23,25}, {23,24,26},
+    {24,25,0}, {25,26,1}, {26,0,2}, {0,4,14}, {1,5,15}, {2,6,16}, {3,7,17}, {4,8,18},
+    {5,9,19}, {6,10,20}, {7,11,21}, {8,12,22}, {9,13,23}, {10,14,24}, {11,15,25}, {12,16,26},
+    {13,17,0}, {14,18,1}, {15,19,2}, {16,20,3}, {17,21,4}, {18,22,5}, {19,23,6}, {20,24,7},
+    {21,25,8}, {22,26,9}, {23,0,10}, {24,1,11}, {25,2,12}, {26,3,13}, {0,5,11}, {1,6,12},
+    {2,7,13}, {3,8,14}, {4,9,15}, {5,10,16}, {6,11,17}, {7,12,18}, {8,13,19}, {9,14,20},
+    {10,15,21}, {11,16,22}, {12,17,23}, {13,18,24}, {14,19,25}, {15,20,26}, {16,21,0}, {17,22,1},
+    {18,23,2}, {19,24,3}, {20,25,4}, {21,26,5}, {22,0,6}, {23,1,7}, {24,2,8}, {25,3,9},
+    {26,4,10}, {0,7,15}, {1,8,16}, {2,9,17}, {3,10,18}, {4,11,19}, {5,12,20}, {6,13,21},
+    {7,14,22}, {8,15,23}, {9,16,24}, {10,17,25}, {11,18,26}, {12,19,0}, {13,20,1}, {14,21,2},
+    {15,22,3}, {16,23,4}, {17,24,5}, {18,25,6}, {19,26,7}, {20,0,8}, {21,1,9}, {22,2,10},
+    {23,3,11}, {24,4,12}, {25,5,13}, {26,6,14}, {0,9,18}, {1,10,19}, {2,11,20}, {3,12,21},
+    {4,13,22}, {5,14,23}, {6,15,24}, {7,16,25}, {8,17,26}
+};
+
+static const Terna_t STS_V031[155] = {
+    {0,5,17}, {1,6,18}, {2,7,19}, {3,8,20}, {4,9,21}, {5,10,22}, {6,11,23}, {7,12,24},
+    {8,13,25}, {9,14,26}, {10,15,27}, {11,16,28}, {12,17,29}, {13,18,30}, {14,19,0}, {15,20,1},
+    {16,21,2}, {17,22,3}, {18,23,4}, {19,24,5}, {20,25,6}, {21,26,7}, {22,27,8}, {23,28,9},
+    {24,29,10}, {25,30,11}, {26,0,12}, {27,1,13}, {28,2,14}, {29,3,15}, {30,4,16}, {0,2,11},
+    {1,3,12}, {2,4,13}, {3,5,14}, {4,6,15}, {5,7,16}, {6,8,17}, {7,9,18}, {8,10,19},
+    {9,11,20}, {10,12,21}, {11,13,22}, {12,14,23}, {13,15,24}, {14,16,25}, {15,17,26}, {16,18,27},
+    {17,19,28}, {18,20,29}, {19,21,30}, {20,22,0}, {21,23,1}, {22,24,2}, {23,25,3}, {24,26,4},
+    {25,27,5}, {26,28,6}, {27,29,7}, {28,30,8}, {29,0,9}, {30,1,10}, {0,3,16}, {1,4,17},
+    {2,5,18}, {3,6,19}, {4,7,20}, {5,8,21}, {6,9,22}, {7,10,23}, {8,11,24}, {9,12,25},
+    {10,13,26}, {11,14,27}, {12,15,28}, {13,16,29}, {14,17,30}, {15,18,0}, {16,19,1}, {17,20,2},
+    {18,21,3}, {19,22,4}, {20,23,5}, {21,24,6}, {22,25,7}, {23,26,8}, {24,27,9}, {25,28,10},
+    {26,29,11}, {27,30,12}, {28,0,13}, {29,1,14}, {30,2,15}, {0,1,8}, {1,2,9}, {2,3,10},
+    {3,4,11}, {4,5,12}, {5,6,13}, {6,7,14}, {7,8,15}, {8,9,16}, {9,10,17}, {10,11,18},
+    {11,12,19}, {12,13,20}, {13,14,21}, {14,15,22}, {15,16,23}, {16,17,24}, {17,18,25}, {18,19,26},
+    {19,20,27}, {20,21,28}, {21,22,29}, {22,23,30}, {23,24,0}, {24,25,1}, {25,26,2}, {26,27,3},
+    {27,28,4}, {28,29,5}, {29,30,6}, {30,0,7}, {0,4,10}, {1,5,11}, {2,6,12}, {3,7,13},
+    {4,8,14}, {5,9,15}, {6,10,16}, {7,11,17}, {8,12,18}, {9,13,19}, {10,14,20}, {11,15,21},
+    {12,16,22}, {13,17,23}, {14,18,24}, {15,19,25}, {16,20,26}, {17,21,27}, {18,22,28}, {19,23,29},
+    {20,24,30}, {21,25,0}, {22,26,1}, {23,27,2}, {24,28,3}, {25,29,4}, {26,30,5}, {27,0,6},
+    {28,1,7}, {29,2,8}, {30,3,9}
+};
+
+static const Terna_t STS_V033[176] = {
+    {0,1,8}, {1,2,9}, {2,3,10}, {3,4,11}, {4,5,12}, {5,6,13}, {6,7,14}, {7,8,15},
+    {8,9,16}, {9,10,17}, {10,11,18}, {11,12,19}, {12,13,20}, {13,14,21}, {14,15,22}, {15,16,23},
+    {16,17,24}, {17,18,25}, {18,19,26}, {19,20,27}, {20,21,28}, {21,22,29}, {22,23,30}, {23,24,31},
+    {24,25,32}, {25,26,0}, {26,27,1}, {27,28,2}, {28,29,3}, {29,30,4}, {30,31,5}, {31,32,6},
+    {32,0,7}, {0,2,16}, {1,3,17}, {2,4,18}, {3,5,19}, {4,6,20}, {5,7,21}, {6,8,22},
+    {7,9,23}, {8,10,24}, {9,11,25}, {10,12,26}, {11,13,27}, {12,14,28}, {13,15,29}, {14,16,30},
+    {15,17,31}, {16,18,32}, {17,19,0}, {18,20,1}, {19,21,2}, {20,22,3}, {21,23,4}, {22,24,5},
+    {23,25,6}, {24,26,7}, {25,27,8}, {26,28,9}, {27,29,10}, {28,30,11}, {29,31,12}, {30,32,13},
+    {31,0,14}, {32,1,15}, {0,3,12}, {1,4,13}, {2,5,14}, {3,6,15}, {4,7,16}, {5,8,17},
+    {6,9,18}, {7,10,19}, {8,11,20}, {9,12,21}, {10,13,22}, {11,14,23}, {12,15,24}, {13,16,25},
+    {14,17,26}, {15,18,27}, {16,19,28}, {17,20,29}, {18,21,30}, {19,22,31}, {20,23,32}, {21,24,0},
+    {22,25,1}, {23,26,2}, {24,27,3}, {25,28,4}, {26,29,5}, {27,30,6}, {28,31,7}, {29,32,8},
+    {30,0,9}, {31,1,10}, {32,2,11}, {0,4,10}, {1,5,11}, {2,6,12}, {3,7,13}, {4,8,14},
+    {5,9,15}, {6,10,16}, {7,11,17}, {8,12,18}, {9,13,19}, {10,14,20}, {11,15,21}, {12,16,22},
+    {13,17,23}, {14,18,24}, {15,19,25}, {16,20,26}, {17,21,27}, {18,22,28}, {19,23,29}, {20,24,30},
+    {21,25,31}, {22,26,32}, {23,27,0}, {24,28,1}, {25,29,2}, {26,30,3}, {27,31,4}, {28,32,5},
+    {29,0,6}, {30,1,7}, {31,2,8}, {32,3,9}, {0,5,18}, {1,6,19}, {2,7,20}, {3,8,21},
+    {4,9,22}, {5,10,23}, {6,11,24}, {7,12,25}, {8,13,26}, {9,14,27}, {10,15,28}, {11,16,29},
+    {12,17,30}, {13,18,31}, {14,19,32}, {15,20,0}, {16,21,1}, {17,22,2}, {18,23,3}, {19,24,4},
+    {20,25,5}, {21,26,6}, {22,27,7}, {23,28,8}, {24,29,9}, {25,30,10}, {26,31,11}, {27,32,12},
+    {28,0,13}, {29,1,14}, {30,2,15}, {31,3,16}, {32,4,17}, {0,11,22}, {1,12,23}, {2,13,24},
+    {3,14,25}, {4,15,26}, {5,16,27}, {6,17,28}, {7,18,29}, {8,19,30}, {9,20,31}, {10,21,32}
+};
+
+static const Terna_t STS_V037[222] = {
+    {0,6,13}, {1,7,14}, {2,8,15}, {3,9,16}, {4,10,17}, {5,11,18}, {6,12,19}, {7,13,20},
+    {8,14,21}, {9,15,22}, {10,16,23}, {11,17,24}, {12,18,25}, {13,19,26}, {14,20,27}, {15,21,28},
+    {16,22,29}, {17,23,30}, {18,24,31}, {19,25,32}, {20,26,33}, {21,27,34}, {22,28,35}, {23,29,36},
+    {24,30,0}, {25,31,1}, {26,32,2}, {27,33,3}, {28,34,4}, {29,35,5}, {30,36,6}, {31,0,7},
+    {32,1,8}, {33,2,9}, {34,3,10}, {35,4,11}, {36,5,12}, {0,1,10}, {1,2,11}, {2,3,12},
+    {3,4,13}, {4,5,14}, {5,6,15}, {6,7,16}, {7,8,17}, {8,9,18}, {9,10,19}, {10,11,20},
+    {11,12,21}, {12,13,22}, {13,14,23}, {14,15,24}, {15,16,25}, {16,17,26}, {17,18,27}, {18,19,28},
+    {19,20,29}, {20,21,30}, {21,22,31}, {22,23,32}, {23,24,33}, {24,25,34}, {25,26,35}, {26,27,36},
+    {27,28,0}, {28,29,1}, {29,30,2}, {30,31,3}, {31,32,4}, {32,33,5}, {33,34,6}, {34,35,7},
+    {35,36,8}, {36,0,9}, {0,2,18}, {1,3,19}, {2,4,20}, {3,5,21}, {4,6,22}, {5,7,23},
+    {6,8,24}, {7,9,25}, {8,10,26}, {9,11,27}, {10,12,28}, {11,13,29}, {12,14,30}, {13,15,31},
+    {14,16,32}, {15,17,33}, {16,18,34}, {17,19,35}, {18,20,36}, {19,21,0}, {20,22,1}, {21,23,2},
+    {22,24,3}, {23,25,4}, {24,26,5}, {25,27,6}, {26,28,7}, {27,29,8}, {28,30,9}, {29,31,10},
+    {30,32,11}, {31,33,12}, {32,34,13}, {33,35,14}, {34,36,15}, {35,0,16}, {36,1,17}, {0,3,14},
+    {1,4,15}, {2,5,16}, {3,6,17}, {4,7,18}, {5,8,19}, {6,9,20}, {7,10,21}, {8,11,22},
+    {9,12,23}, {10,13,24}, {11,14,25}, {12,15,26}, {13,16,27}, {14,17,28}, {15,18,29}, {16,19,30},
+    {17,20,31}, {18,21,32}, {19,22,33}, {20,23,34}, {21,24,35}, {22,25,36}, {23,26,0}, {24,27,1},
+    {25,28,2}, {26,29,3}, {27,30,4}, {28,31,5}, {29,32,6}, {30,33,7}, {31,34,8}, {32,35,9},
+    {33,36,10}, {34,0,11}, {35,1,12}, {36,2,13}, {0,4,12}, {1,5,13}, {2,6,14}, {3,7,15},
+    {4,8,16}, {5,9,17}, {6,10,18}, {7,11,19}, {8,12,20}, {9,13,21}, {10,14,22}, {11,15,23},
+    {12,16,24}, {13,17,25}, {14,18,26}, {15,19,27}, {16,20,28}, {17,21,29}, {18,22,30}, {19,23,31},
+    {20,24,32}, {21,25,33}, {22,26,34}, {23,27,35}, {24,28,36}, {25,29,0}, {26,30,1}, {27,31,2},
+    {28,32,3}, {29,33,4}, {30,34,5}, {31,35,6}, {32,36,7}, {33,0,8}, {34,1,9}, {35,2,10},
+    {36,3,11}, {0,5,20}, {1,6,21}, {2,7,22}, {3,8,23}, {4,9,24}, {5,10,25}, {6,11,26},
+    {7,12,27}, {8,13,28}, {9,14,29}, {10,15,30}, {11,16,31}, {12,17,32}, {13,18,33}, {14,19,34},
+    {15,20,35}, {16,21,36}, {17,22,0}, {18,23,1}, {19,24,2}, {20,25,3}, {21,26,4}, {22,27,5},
+    {23,28,6}, {24,29,7}, {25,30,8}, {26,31,9}, {27,32,10}, {28,33,11}, {29,34,12}, {30,35,13},
+    {31,36,14}, {32,0,15}, {33,1,16}, {34,2,17}, {35,3,18}, {36,4,19}
+};
+
+static const Terna_t STS_V039[247] = {
+    {0,1,18}, {1,2,19}, {2,3,20}, {3,4,21}, {4,5,22}, {5,6,23}, {6,7,24}, {7,8,25},
+    {8,9,26}, {9,10,27}, {10,11,28}, {11,12,29}, {12,13,30}, {13,14,31}, {14,15,32}, {15,16,33},
+    {16,17,34}, {17,18,35}, {18,19,36}, {19,20,37}, {20,21,38}, {21,22,0}, {22,23,1}, {23,24,2},
+    {24,25,3}, {25,26,4}, {26,27,5}, {27,28,6}, {28,29,7}, {29,30,8}, {30,31,9}, {31,32,10},
+    {32,33,11}, {33,34,12}, {34,35,13}, {35,36,14}, {36,37,15}, {37,38,16}, {38,0,17}, {0,2,10},
+    {1,3,11}, {2,4,12}, {3,5,13}, {4,6,14}, {5,7,15}, {6,8,16}, {7,9,17}, {8,10,18},
+    {9,11,19}, {10,12,20}, {11,13,21}, {12,14,22}, {13,15,23}, {14,16,24}, {15,17,25}, {16,18,26},
+    {17,19,27}, {18,20,28}, {19,21,29}, {20,22,30}, {21,23,31}, {22,24,32}, {23,25,33}, {24,26,34},
+    {25,27,35}, {26,28,36}, {27,29,37}, {28,30,38}, {29,31,0}, {30,32,1}, {31,33,2}, {32,34,3},
+    {33,35,4}, {34,36,5}, {35,37,6}, {36,38,7}, {37,0,8}, {38,1,9}, {0,3,14}, {1,4,15},
+    {2,5,16}, {3,6,17}, {4,7,18}, {5,8,19}, {6,9,20}, {7,10,21}, {8,11,22}, {9,12,23},
+    {10,13,24}, {11,14,25}, {12,15,26}, {13,16,27}, {14,17,28}, {15,18,29}, {16,19,30}, {17,20,31},
+    {18,21,32}, {19,22,33}, {20,23,34}, {21,24,35}, {22,25,36}, {23,26,37}, {24,27,38}, {25,28,0},
+    {26,29,1}, {27,30,2}, {28,31,3}, {29,32,4}, {30,33,5}, {31,34,6}, {32,35,7}, {33,36,8},
+    {34,37,9}, {35,38,10}, {36,0,11}, {37,1,12}, {38,2,13}, {0,4,20}, {1,5,21}, {2,6,22},
+    {3,7,23}, {4,8,24}, {5,9,25}, {6,10,26}, {7,11,27}, {8,12,28}, {9,13,29}, {10,14,30},
+    {11,15,31}, {12,16,32}, {13,17,33}, {14,18,34}, {15,19,35}, {16,20,36}, {17,21,37}, {18,22,38},
+    {19,23,0}, {20,24,1}, {21,25,2}, {22,26,3}, {23,27,4}, {24,28,5}, {25,29,6}, {26,30,7},
+    {27,31,8}, {28,32,9}, {29,33,10}, {30,34,11}, {31,35,12}, {32,36,13}, {33,37,14}, {34,38,15},
+    {35,0,16}, {36,1,17}, {37,2,18}, {38,3,19}, {0,5,12}, {1,6,13}, {2,7,14}, {3,8,15},
+    {4,9,16}, {5,10,17}, {6,11,18}, {7,12,19}, {8,13,20}, {9,14,21}, {10,15,22}, {11,16,23},
+    {12,17,24}, {13,18,25}, {14,19,26}, {15,20,27}, {16,21,28}, {17,22,29}, {18,23,30}, {19,24,31},
+    {20,25,32}, {21,26,33}, {22,27,34}, {23,28,35}, {24,29,36}, {25,30,37}, {26,31,38}, {27,32,0},
+    {28,33,1}, {29,34,2}, {30,35,3}, {31,36,4}, {32,37,5}, {33,38,6}, {34,0,7}, {35,1,8},
+    {36,2,9}, {37,3,10}, {38,4,11}, {0,6,15}, {1,7,16}, {2,8,17}, {3,9,18}, {4,10,19},
+    {5,11,20}, {6,12,21}, {7,13,22}, {8,14,23}, {9,15,24}, {10,16,25}, {11,17,26}, {12,18,27},
+    {13,19,28}, {14,20,29}, {15,21,30}, {16,22,31}, {17,23,32}, {18,24,33}, {19,25,34}, {20,26,35},
+    {21,27,36}, {22,28,37}, {23,29,38}, {24,30,0}, {25,31,1}, {26,32,2}, {27,33,3}, {28,34,4},
+    {29,35,5}, {30,36,6}, {31,37,7}, {32,38,8}, {33,0,9}, {34,1,10}, {35,2,11}, {36,3,12},
+    {37,4,13}, {38,5,14}, {0,13,26}, {1,14,27}, {2,15,28}, {3,16,29}, {4,17,30}, {5,18,31},
+    {6,19,32}, {7,20,33}, {8,21,34}, {9,22,35}, {10,23,36}, {11,24,37}, {12,25,38}
+};
+
+static const Terna_t STS_V043[301] = {
+    {0,7,17}, {1,8,18}, {2,9,19}, {3,10,20}, {4,11,21}, {5,12,22}, {6,13,23}, {7,14,24},
+    {8,15,25}, {9,16,26}, {10,17,27}, {11,18,28}, {12,19,29}, {13,20,30}, {14,21,31}, {15,22,32},
+    {16,23,33}, {17,24,34}, {18,25,35}, {19,26,36}, {20,27,37}, {21,28,38}, {22,29,39}, {23,30,40},
+    {24,31,41}, {25,32,42}, {26,33,0}, {27,34,1}, {28,35,2}, {29,36,3}, {30,37,4}, {31,38,5},
+    {32,39,6}, {33,40,7}, {34,41,8}, {35,42,9}, {36,0,10}, {37,1,11}, {38,2,12}, {39,3,13},
+    {40,4,14}, {41,5,15}, {42,6,16}, {0,1,20}, {1,2,21}, {2,3,22}, {3,4,23}, {4,5,24},
+    {5,6,25}, {6,7,26}, {7,8,27}, {8,9,28}, {9,10,29}, {10,11,30}, {11,12,31}, {12,13,32},
+    {13,14,33}, {14,15,34}, {15,16,35}, {16,17,36}, {17,18,37}, {18,19,38}, {19,20,39}, {20,21,40},
+    {21,22,41}, {22,23,42}, {23,24,0}, {24,25,1}, {25,26,2}, {26,27,3}, {27,28,4}, {28,29,5},
+    {29,30,6}, {30,31,7}, {31,32,8}, {32,33,9}, {33,34,10}, {34,35,11}, {35,36,12}, {36,37,13},
+    {37,38,14}, {38,39,15}, {39,40,16}, {40,41,17}, {41,42,18}, {42,0,19}, {0,2,15}, {1,3,16},
+    {2,4,17}, {3,5,18}, {4,6,19}, {5,7,20}, {6,8,21}, {7,9,22}, {8,10,23}, {9,11,24},
+    {10,12,25}, {11,13,26}, {12,14,27}, {13,15,28}, {14,16,29}, {15,17,30}, {16,18,31}, {17,19,32},
+    {18,20,33}, {19,21,34}, {20,22,35}, {21,23,36}, {22,24,37}, {23,25,38}, {24,26,39}, {25,27,40},
+    {26,28,41}, {27,29,42}, {28,30,0}, {29,31,1}, {30,32,2}, {31,33,3}, {32,34,4}, {33,35,5},
+    {34,36,6}, {35,37,7}, {36,38,8}, {37,39,9}, {38,40,10}, {39,41,11}, {40,42,12}, {41,0,13},
+    {42,1,14}, {0,3,12}, {1,4,13}, {2,5,14}, {3,6,15}, {4,7,16}, {5,8,17}, {6,9,18},
+    {7,10,19}, {8,11,20}, {9,12,21}, {10,13,22}, {11,14,23}, {12,15,24}, {13,16,25}, {14,17,26},
+    {15,18,27}, {16,19,28}, {17,20,29}, {18,21,30}, {19,22,31}, {20,23,32}, {21,24,33}, {22,25,34},
+    {23,26,35}, {24,27,36}, {25,28,37}, {26,29,38}, {27,30,39}, {28,31,40}, {29,32,41}, {30,33,42},
+    {31,34,0}, {32,35,1}, {33,36,2}, {34,37,3}, {35,38,4}, {36,39,5}, {37,40,6}, {38,41,7},
+    {39,42,8}, {40,0,9}, {41,1,10}, {42,2,11}, {0,4,22}, {1,5,23}, {2,6,24}, {3,7,25},
+    {4,8,26}, {5,9,27}, {6,10,28}, {7,11,29}, {8,12,30}, {9,13,31}, {10,14,32}, {11,15,33},
+    {12,16,34}, {13,17,35}, {14,18,36}, {15,19,37}, {16,20,38}, {17,21,39}, {18,22,40}, {19,23,41},
+    {20,24,42}, {21,25,0}, {22,26,1}, {23,27,2}, {24,28,3}, {25,29,4}, {26,30,5}, {27,31,6},
+    {28,32,7}, {29,33,8}, {30,34,9}, {31,35,10}, {32,36,11}, {33,37,12}, {34,38,13}, {35,39,14},
+    {36,40,15}, {37,41,16}, {38,42,17}, {39,0,18}, {40,1,19}, {41,2,20}, {42,3,21}, {0,5,16},
+    {1,6,17}, {2,7,18}, {3,8,19}, {4,9,20}, {5,10,21}, {6,11,22}, {7,12,23}, {8,13,24},
+    {9,14,25}, {10,15,26}, {11,16,27}, {12,17,28}, {13,18,29}, {14,19,30}, {15,20,31}, {16,21,32},
+    {17,22,33}, {18,23,34}, {19,24,35}, {20,25,36}, {21,26,37}, {22,27,38}, {23,28,39}, {24,29,40},
+    {25,30,41}, {26,31,42}, {27,32,0}, {28,33,1}, {29,34,2}, {30,35,3}, {31,36,4}, {32,37,5},
+    {33,38,6}, {34,39,7}, {35,40,8}, {36,41,9}, {37,42,10}, {38,0,11}, {39,1,12}, {40,2,13},
+    {41,3,14}, {42,4,15}, {0,6,14}, {1,7,15}, {2,8,16}, {3,9,17}, {4,10,18}, {5,11,19},
+    {6,12,20}, {7,13,21}, {8,14,22}, {9,15,23}, {10,16,24}, {11,17,25}, {12,18,26}, {13,19,27},
+    {14,20,28}, {15,21,29}, {16,22,30}, {17,23,31}, {18,24,32}, {19,25,33}, {20,26,34}, {21,27,35},
+    {22,28,36}, {23,29,37}, {24,30,38}, {25,31,39}, {26,32,40}, {27,33,41}, {28,34,42}, {29,35,0},
+    {30,36,1}, {31,37,2}, {32,38,3}, {33,39,4}, {34,40,5}, {35,41,6}, {36,42,7}, {37,0,8},
+    {38,1,9}, {39,2,10}, {40,3,11}, {41,4,12}, {42,5,13}
+};
+
+static const Terna_t STS_V045[330] = {
+    {0,1,12}, {1,2,13}, {2,3,14}, {3,4,15}, {4,5,16}, {5,6,17}, {6,7,18}, {7,8,19},
+    {8,9,20}, {9,10,21}, {10,11,22}, {11,12,23}, {12,13,24}, {13,14,25}, {14,15,26}, {15,16,27},
+    {16,17,28}, {17,18,29}, {18,19,30}, {19,20,31}, {20,21,32}, {21,22,33}, {22,23,34}, {23,24,35},
+    {24,25,36}, {25,26,37}, {26,27,38}, {27,28,39}, {28,29,40}, {29,30,41}, {30,31,42}, {31,32,43},
+    {32,33,44}, {33,34,0}, {34,35,1}, {35,36,2}, {36,37,3}, {37,38,4}, {38,39,5}, {39,40,6},
+    {40,41,7}, {41,42,8}, {42,43,9}, {43,44,10}, {44,0,11}, {0,2,19}, {1,3,20}, {2,4,21},
+    {3,5,22}, {4,6,23}, {5,7,24}, {6,8,25}, {7,9,26}, {8,10,27}, {9,11,28}, {10,12,29},
+    {11,13,30}, {12,14,31}, {13,15,32}, {14,16,33}, {15,17,34}, {16,18,35}, {17,19,36}, {18,20,37},
+    {19,21,38}, {20,22,39}, {21,23,40}, {22,24,41}, {23,25,42}, {24,26,43}, {25,27,44}, {26,28,0},
+    {27,29,1}, {28,30,2}, {29,31,3}, {30,32,4}, {31,33,5}, {32,34,6}, {33,35,7}, {34,36,8},
+    {35,37,9}, {36,38,10}, {37,39,11}, {38,40,12}, {39,41,13}, {40,42,14}, {41,43,15}, {42,44,16},
+    {43,0,17}, {44,1,18}, {0,3,23}, {1,4,24}, {2,5,25}, {3,6,26}, {4,7,27}, {5,8,28},
+    {6,9,29}, {7,10,30}, {8,11,31}, {9,12,32}, {10,13,33}, {11,14,34}, {12,15,35}, {13,16,36},
+    {14,17,37}, {15,18,38}, {16,19,39}, {17,20,40}, {18,21,41}, {19,22,42}, {20,23,43}, {21,24,44},
+    {22,25,0}, {23,26,1}, {24,27,2}, {25,28,3}, {26,29,4}, {27,30,5}, {28,31,6}, {29,32,7},
+    {30,33,8}, {31,34,9}, {32,35,10}, {33,36,11}, {34,37,12}, {35,38,13}, {36,39,14}, {37,40,15},
+    {38,41,16}, {39,42,17}, {40,43,18}, {41,44,19}, {42,0,20}, {43,1,21}, {44,2,22}, {0,4,14},
+    {1,5,15}, {2,6,16}, {3,7,17}, {4,8,18}, {5,9,19}, {6,10,20}, {7,11,21}, {8,12,22},
+    {9,13,23}, {10,14,24}, {11,15,25}, {12,16,26}, {13,17,27}, {14,18,28}, {15,19,29}, {16,20,30},
+    {17,21,31}, {18,22,32}, {19,23,33}, {20,24,34}, {21,25,35}, {22,26,36}, {23,27,37}, {24,28,38},
+    {25,29,39}, {26,30,40}, {27,31,41}, {28,32,42}, {29,33,43}, {30,34,44}, {31,35,0}, {32,36,1},
+    {33,37,2}, {34,38,3}, {35,39,4}, {36,40,5}, {37,41,6}, {38,42,7}, {39,43,8}, {40,44,9},
+    {41,0,10}, {42,1,11}, {43,2,12}, {44,3,13}, {0,5,13}, {1,6,14}, {2,7,15}, {3,8,16},
+    {4,9,17}, {5,10,18}, {6,11,19}, {7,12,20}, {8,13,21}, {9,14,22}, {10,15,23}, {11,16,24},
+    {12,17,25}, {13,18,26}, {14,19,27}, {15,20,28}, {16,21,29}, {17,22,30}, {18,23,31}, {19,24,32},
+    {20,25,33}, {21,26,34}, {22,27,35}, {23,28,36}, {24,29,37}, {25,30,38}, {26,31,39}, {27,32,40},
+    {28,33,41}, {29,34,42}, {30,35,43}, {31,36,44}, {32,37,0}, {33,38,1}, {34,39,2}, {35,40,3},
+    {36,41,4}, {37,42,5}, {38,43,6}, {39,44,7}, {40,0,8}, {41,1,9}, {42,2,10}, {43,3,11},
+    {44,4,12}, {0,6,24}, {1,7,25}, {2,8,26}, {3,9,27}, {4,10,28}, {5,11,29}, {6,12,30},
+    {7,13,31}, {8,14,32}, {9,15,33}, {10,16,34}, {11,17,35}, {12,18,36}, {13,19,37}, {14,20,38},
+    {15,21,39}, {16,22,40}, {17,23,41}, {18,24,42}, {19,25,43}, {20,26,44}, {21,27,0}, {22,28,1},
+    {23,29,2}, {24,30,3}, {25,31,4}, {26,32,5}, {27,33,6}, {28,34,7}, {29,35,8}, {30,36,9},
+    {31,37,10}, {32,38,11}, {33,39,12}, {34,40,13}, {35,41,14}, {36,42,15}, {37,43,16}, {38,44,17},
+    {39,0,18}, {40,1,19}, {41,2,20}, {42,3,21}, {43,4,22}, {44,5,23}, {0,7,16}, {1,8,17},
+    {2,9,18}, {3,10,19}, {4,11,20}, {5,12,21}, {6,13,22}, {7,14,23}, {8,15,24}, {9,16,25},
+    {10,17,26}, {11,18,27}, {12,19,28}, {13,20,29}, {14,21,30}, {15,22,31}, {16,23,32}, {17,24,33},
+    {18,25,34}, {19,26,35}, {20,27,36}, {21,28,37}, {22,29,38}, {23,30,39}, {24,31,40}, {25,32,41},
+    {26,33,42}, {27,34,43}, {28,35,44}, {29,36,0}, {30,37,1}, {31,38,2}, {32,39,3}, {33,40,4},
+    {34,41,5}, {35,42,6}, {36,43,7}, {37,44,8}, {38,0,9}, {39,1,10}, {40,2,11}, {41,3,12},
+    {42,4,13}, {43,5,14}, {44,6,15}, {0,15,30}, {1,16,31}, {2,17,32}, {3,18,33}, {4,19,34},
+    {5,20,35}, {6,21,36}, {7,22,37}, {8,23,38}, {9,24,39}, {10,25,40}, {11,26,41}, {12,27,42},
+    {13,28,43}, {14,29,44}
+};
+
+static const Terna_t STS_V049[392] = {
+    {0,8,27}, {1,9,28}, {2,10,29}, {3,11,30}, {4,12,31}, {5,13,32}, {6,14,33}, {7,15,34},
+    {8,16,35}, {9,17,36}, {10,18,37}, {11,19,38}, {12,20,39}, {13,21,40}, {14,22,41}, {15,23,42},
+    {16,24,43}, {17,25,44}, {18,26,45}, {19,27,46}, {20,28,47}, {21,29,48}, {22,30,0}, {23,31,1},
+    {24,32,2}, {25,33,3}, {26,34,4}, {27,35,5}, {28,36,6}, {29,37,7}, {30,38,8}, {31,39,9},
+    {32,40,10}, {33,41,11}, {34,42,12}, {35,43,13}, {36,44,14}, {37,45,15}, {38,46,16}, {39,47,17},
+    {40,48,18}, {41,0,19}, {42,1,20}, {43,2,21}, {44,3,22}, {45,4,23}, {46,5,24}, {47,6,25},
+    {48,7,26}, {0,2,17}, {1,3,18}, {2,4,19}, {3,5,20}, {4,6,21}, {5,7,22}, {6,8,23},
+    {7,9,24}, {8,10,25}, {9,11,26}, {10,12,27}, {11,13,28}, {12,14,29}, {13,15,30}, {14,16,31},
+    {15,17,32}, {16,18,33}, {17,19,34}, {18,20,35}, {19,21,36}, {20,22,37}, {21,23,38}, {22,24,39},
+    {23,25,40}, {24,26,41}, {25,27,42}, {26,28,43}, {27,29,44}, {28,30,45}, {29,31,46}, {30,32,47},
+    {31,33,48}, {32,34,0}, {33,35,1}, {34,36,2}, {35,37,3}, {36,38,4}, {37,39,5}, {38,40,6},
+    {39,41,7}, {40,42,8}, {41,43,9}, {42,44,10}, {43,45,11}, {44,46,12}, {45,47,13}, {46,48,14},
+    {47,0,15}, {48,1,16}, {0,3,24}, {1,4,25}, {2,5,26}, {3,6,27}, {4,7,28}, {5,8,29},
+    {6,9,30}, {7,10,31}, {8,11,32}, {9,12,33}, {10,13,34}, {11,14,35}, {12,15,36}, {13,16,37},
+    {14,17,38}, {15,18,39}, {16,19,40}, {17,20,41}, {18,21,42}, {19,22,43}, {20,23,44}, {21,24,45},
+    {22,25,46}, {23,26,47}, {24,27,48}, {25,28,0}, {26,29,1}, {27,30,2}, {28,31,3}, {29,32,4},
+    {30,33,5}, {31,34,6}, {32,35,7}, {33,36,8}, {34,37,9}, {35,38,10}, {36,39,11}, {37,40,12},
+    {38,41,13}, {39,42,14}, {40,43,15}, {41,44,16}, {42,45,17}, {43,46,18}, {44,47,19}, {45,48,20},
+    {46,0,21}, {47,1,22}, {48,2,23}, {0,1,12}, {1,2,13}, {2,3,14}, {3,4,15}, {4,5,16},
+    {5,6,17}, {6,7,18}, {7,8,19}, {8,9,20}, {9,10,21}, {10,11,22}, {11,12,23}, {12,13,24},
+    {13,14,25}, {14,15,26}, {15,16,27}, {16,17,28}, {17,18,29}, {18,19,30}, {19,20,31}, {20,21,32},
+    {21,22,33}, {22,23,34}, {23,24,35}, {24,25,36}, {25,26,37}, {26,27,38}, {27,28,39}, {28,29,40},
+    {29,30,41}, {30,31,42}, {31,32,43}, {32,33,44}, {33,34,45}, {34,35,46}, {35,36,47}, {36,37,48},
+    {37,38,0}, {38,39,1}, {39,40,2}, {40,41,3}, {41,42,4}, {42,43,5}, {43,44,6}, {44,45,7},
+    {45,46,8}, {46,47,9}, {47,48,10}, {48,0,11}, {0,5,18}, {1,6,19}, {2,7,20}, {3,8,21},
+    {4,9,22}, {5,10,23}, {6,11,24}, {7,12,25}, {8,13,26}, {9,14,27}, {10,15,28}, {11,16,29},
+    {12,17,30}, {13,18,31}, {14,19,32}, {15,20,33}, {16,21,34}, {17,22,35}, {18,23,36}, {19,24,37},
+    {20,25,38}, {21,26,39}, {22,27,40}, {23,28,41}, {24,29,42}, {25,30,43}, {26,31,44}, {27,32,45},
+    {28,33,46}, {29,34,47}, {30,35,48}, {31,36,0}, {32,37,1}, {33,38,2}, {34,39,3}, {35,40,4},
+    {36,41,5}, {37,42,6}, {38,43,7}, {39,44,8}, {40,45,9}, {41,46,10}, {42,47,11}, {43,48,12},
+    {44,0,13}, {45,1,14}, {46,2,15}, {47,3,16}, {48,4,17}, {0,6,26}, {1,7,27}, {2,8,28},
+    {3,9,29}, {4,10,30}, {5,11,31}, {6,12,32}, {7,13,33}, {8,14,34}, {9,15,35}, {10,16,36},
+    {11,17,37}, {12,18,38}, {13,19,39}, {14,20,40}, {15,21,41}, {16,22,42}, {17,23,43}, {18,24,44},
+    {19,25,45}, {20,26,46}, {21,27,47}, {22,28,48}, {23,29,0}, {24,30,1}, {25,31,2}, {26,32,3},
+    {27,33,4}, {28,34,5}, {29,35,6}, {30,36,7}, {31,37,8}, {32,38,9}, {33,39,10}, {34,40,11},
+    {35,41,12}, {36,42,13}, {37,43,14}, {38,44,15}, {39,45,16}, {40,46,17}, {41,47,18}, {42,48,19},
+    {43,0,20}, {44,1,21}, {45,2,22}, {46,3,23}, {47,4,24}, {48,5,25}, {0,4,14}, {1,5,15},
+    {2,6,16}, {3,7,17}, {4,8,18}, {5,9,19}, {6,10,20}, {7,11,21}, {8,12,22}, {9,13,23},
+    {10,14,24}, {11,15,25}, {12,16,26}, {13,17,27}, {14,18,28}, {15,19,29}, {16,20,30}, {17,21,31},
+    {18,22,32}, {19,23,33}, {20,24,34}, {21,25,35}, {22,26,36}, {23,27,37}, {24,28,38}, {25,29,39},
+    {26,30,40}, {27,31,41}, {28,32,42}, {29,33,43}, {30,34,44}, {31,35,45}, {32,36,46}, {33,37,47},
+    {34,38,48}, {35,39,0}, {36,40,1}, {37,41,2}, {38,42,3}, {39,43,4}, {40,44,5}, {41,45,6},
+    {42,46,7}, {43,47,8}, {44,48,9}, {45,0,10}, {46,1,11}, {47,2,12}, {48,3,13}, {0,7,16},
+    {1,8,17}, {2,9,18}, {3,10,19}, {4,11,20}, {5,12,21}, {6,13,22}, {7,14,23}, {8,15,24},
+    {9,16,25}, {10,17,26}, {11,18,27}, {12,19,28}, {13,20,29}, {14,21,30}, {15,22,31}, {16,23,32},
+    {17,24,33}, {18,25,34}, {19,26,35}, {20,27,36}, {21,28,37}, {22,29,38}, {23,30,39}, {24,31,40},
+    {25,32,41}, {26,33,42}, {27,34,43}, {28,35,44}, {29,36,45}, {30,37,46}, {31,38,47}, {32,39,48},
+    {33,40,0}, {34,41,1}, {35,42,2}, {36,43,3}, {37,44,4}, {38,45,5}, {39,46,6}, {40,47,7},
+    {41,48,8}, {42,0,9}, {43,1,10}, {44,2,11}, {45,3,12}, {46,4,13}, {47,5,14}, {48,6,15}
+};
+
+static const Terna_t STS_V051[425] = {
+    {0,1,12}, {1,2,13}, {2,3,14}, {3,4,15}, {4,5,16}, {5,6,17}, {6,7,18}, {7,8,19},
+    {8,9,20}, {9,10,21}, {10,11,22}, {11,12,23}, {12,13,24}, {13,14,25}, {14,15,26}, {15,16,27},
+    {16,17,28}, {17,18,29}, {18,19,30}, {19,20,31}, {20,21,32}, {21,22,33}, {22,23,34}, {23,24,35},
+    {24,25,36}, {25,26,37}, {26,27,38}, {27,28,39}, {28,29,40}, {29,30,41}, {30,31,42}, {31,32,43},
+    {32,33,44}, {33,34,45}, {34,35,46}, {35,36,47}, {36,37,48}, {37,38,49}, {38,39,50}, {39,40,0},
+    {40,41,1}, {41,42,2}, {42,43,3}, {43,44,4}, {44,45,5}, {45,46,6}, {46,47,7}, {47,48,8},
+    {48,49,9}, {49,50,10}, {50,0,11}, {0,2,24}, {1,3,25}, {2,4,26}, {3,5,27}, {4,6,28},
+    {5,7,29}, {6,8,30}, {7,9,31}, {8,10,32}, {9,11,33}, {10,12,34}, {11,13,35}, {12,14,36},
+    {13,15,37}, {14,16,38}, {15,17,39}, {16,18,40}, {17,19,41}, {18,20,42}, {19,21,43}, {20,22,44},
+    {21,23,45}, {22,24,46}, {23,25,47}, {24,26,48}, {25,27,49}, {26,28,50}, {27,29,0}, {28,30,1},
+    {29,31,2}, {30,32,3}, {31,33,4}, {32,34,5}, {33,35,6}, {34,36,7}, {35,37,8}, {36,38,9},
+    {37,39,10}, {38,40,11}, {39,41,12}, {40,42,13}, {41,43,14}, {42,44,15}, {43,45,16}, {44,46,17},
+    {45,47,18}, {46,48,19}, {47,49,20}, {48,50,21}, {49,0,22}, {50,1,23}, {0,3,18}, {1,4,19},
+    {2,5,20}, {3,6,21}, {4,7,22}, {5,8,23}, {6,9,24}, {7,10,25}, {8,11,26}, {9,12,27},
+    {10,13,28}, {11,14,29}, {12,15,30}, {13,16,31}, {14,17,32}, {15,18,33}, {16,19,34}, {17,20,35},
+    {18,21,36}, {19,22,37}, {20,23,38}, {21,24,39}, {22,25,40}, {23,26,41}, {24,27,42}, {25,28,43},
+    {26,29,44}, {27,30,45}, {28,31,46}, {29,32,47}, {30,33,48}, {31,34,49}, {32,35,50}, {33,36,0},
+    {34,37,1}, {35,38,2}, {36,39,3}, {37,40,4}, {38,41,5}, {39,42,6}, {40,43,7}, {41,44,8},
+    {42,45,9}, {43,46,10}, {44,47,11}, {45,48,12}, {46,49,13}, {47,50,14}, {48,0,15}, {49,1,16},
+    {50,2,17}, {0,4,14}, {1,5,15}, {2,6,16}, {3,7,17}, {4,8,18}, {5,9,19}, {6,10,20},
+    {7,11,21}, {8,12,22}, {9,13,23}, {10,14,24}, {11,15,25}, {12,16,26}, {13,17,27}, {14,18,28},
+    {15,19,29}, {16,20,30}, {17,21,31}, {18,22,32}, {19,23,33}, {20,24,34}, {21,25,35}, {22,26,36},
+    {23,27,37}, {24,28,38}, {25,29,39}, {26,30,40}, {27,31,41}, {28,32,42}, {29,33,43}, {30,34,44},
+    {31,35,45}, {32,36,46}, {33,37,47}, {34,38,48}, {35,39,49}, {36,40,50}, {37,41,0}, {38,42,1},
+    {39,43,2}, {40,44,3}, {41,45,4}, {42,46,5}, {43,47,6}, {44,48,7}, {45,49,8}, {46,50,9},
+    {47,0,10}, {48,1,11}, {49,2,12}, {50,3,13}, {0,5,26}, {1,6,27}, {2,7,28}, {3,8,29},
+    {4,9,30}, {5,10,31}, {6,11,32}, {7,12,33}, {8,13,34}, {9,14,35}, {10,15,36}, {11,16,37},
+    {12,17,38}, {13,18,39}, {14,19,40}, {15,20,41}, {16,21,42}, {17,22,43}, {18,23,44}, {19,24,45},
+    {20,25,46}, {21,26,47}, {22,27,48}, {23,28,49}, {24,29,50}, {25,30,0}, {26,31,1}, {27,32,2},
+    {28,33,3}, {29,34,4}, {30,35,5}, {31,36,6}, {32,37,7}, {33,38,8}, {34,39,9}, {35,40,10},
+    {36,41,11}, {37,42,12}, {38,43,13}, {39,44,14}, {40,45,15}, {41,46,16}, {42,47,17}, {43,48,18},
+    {44,49,19}, {45,50,20}, {46,0,21}, {47,1,22}, {48,2,23}, {49,3,24}, {50,4,25}, {0,6,19},
+    {1,7,20}, {2,8,21}, {3,9,22}, {4,10,23}, {5,11,24}, {6,12,25}, {7,13,26}, {8,14,27},
+    {9,15,28}, {10,16,29}, {11,17,30}, {12,18,31}, {13,19,32}, {14,20,33}, {15,21,34}, {16,22,35},
+    {17,23,36}, {18,24,37}, {19,25,38}, {20,26,39}, {21,27,40}, {22,28,41}, {23,29,42}, {24,30,43},
+    {25,31,44}, {26,32,45}, {27,33,46}, {28,34,47}, {29,35,48}, {30,36,49}, {31,37,50}, {32,38,0},
+    {33,39,1}, {34,40,2}, {35,41,3}, {36,42,4}, {37,43,5}, {38,44,6}, {39,45,7}, {40,46,8},
+    {41,47,9}, {42,48,10}, {43,49,11}, {44,50,12}, {45,0,13}, {46,1,14}, {47,2,15}, {48,3,16},
+    {49,4,17}, {50,5,18}, {0,7,16}, {1,8,17}, {2,9,18}, {3,10,19}, {4,11,20}, {5,12,21},
+    {6,13,22}, {7,14,23}, {8,15,24}, {9,16,25}, {10,17,26}, {11,18,27}, {12,19,28}, {13,20,29},
+    {14,21,30}, {15,22,31}, {16,23,32}, {17,24,33}, {18,25,34}, {19,26,35}, {20,27,36}, {21,28,37},
+    {22,29,38}, {23,30,39}, {24,31,40}, {25,32,41}, {26,33,42}, {27,34,43}, {28,35,44}, {29,36,45},
+    {30,37,46}, {31,38,47}, {32,39,48}, {33,40,49}, {34,41,50}, {35,42,0}, {36,43,1}, {37,44,2},
+    {38,45,3}, {39,46,4}, {40,47,5}, {41,48,6}, {42,49,7}, {43,50,8}, {44,0,9}, {45,1,10},
+    {46,2,11}, {47,3,12}, {48,4,13}, {49,5,14}, {50,6,15}, {0,8,28}, {1,9,29}, {2,10,30},
+    {3,11,31}, {4,12,32}, {5,13,33}, {6,14,34}, {7,15,35}, {8,16,36}, {9,17,37}, {10,18,38},
+    {11,19,39}, {12,20,40}, {13,21,41}, {14,22,42}, {15,23,43}, {16,24,44}, {17,25,45}, {18,26,46},
+    {19,27,47}, {20,28,48}, {21,29,49}, {22,30,50}, {23,31,0}, {24,32,1}, {25,33,2}, {26,34,3},
+    {27,35,4}, {28,36,5}, {29,37,6}, {30,38,7}, {31,39,8}, {32,40,9}, {33,41,10}, {34,42,11},
+    {35,43,12}, {36,44,13}, {37,45,14}, {38,46,15}, {39,47,16}, {40,48,17}, {41,49,18}, {42,50,19},
+    {43,0,20}, {44,1,21}, {45,2,22}, {46,3,23}, {47,4,24}, {48,5,25}, {49,6,26}, {50,7,27},
+    {0,17,34}, {1,18,35}, {2,19,36}, {3,20,37}, {4,21,38}, {5,22,39}, {6,23,40}, {7,24,41},
+    {8,25,42}, {9,26,43}, {10,27,44}, {11,28,45}, {12,29,46}, {13,30,47}, {14,31,48}, {15,32,49},
+    {16,33,50}
+};
+
+static const Terna_t STS_V055[495] = {
+    {0,9,19}, {1,10,20}, {2,11,21}, {3,12,22}, {4,13,23}, {5,14,24}, {6,15,25}, {7,16,26},
+    {8,17,27}, {9,18,28}, {10,19,29}, {11,20,30}, {12,21,31}, {13,22,32}, {14,23,33}, {15,24,34},
+    {16,25,35}, {17,26,36}, {18,27,37}, {19,28,38}, {20,29,39}, {21,30,40}, {22,31,41}, {23,32,42},
+    {24,33,43}, {25,34,44}, {26,35,45}, {27,36,46}, {28,37,47}, {29,38,48}, {30,39,49}, {31,40,50},
+    {32,41,51}, {33,42,52}, {34,43,53}, {35,44,54}, {36,45,0}, {37,46,1}, {38,47,2}, {39,48,3},
+    {40,49,4}, {41,50,5}, {42,51,6}, {43,52,7}, {44,53,8}, {45,54,9}, {46,0,10}, {47,1,11},
+    {48,2,12}, {49,3,13}, {50,4,14}, {51,5,15}, {52,6,16}, {53,7,17}, {54,8,18}, {0,1,14},
+    {1,2,15}, {2,3,16}, {3,4,17}, {4,5,18}, {5,6,19}, {6,7,20}, {7,8,21}, {8,9,22},
+    {9,10,23}, {10,11,24}, {11,12,25}, {12,13,26}, {13,14,27}, {14,15,28}, {15,16,29}, {16,17,30},
+    {17,18,31}, {18,19,32}, {19,20,33}, {20,21,34}, {21,22,35}, {22,23,36}, {23,24,37}, {24,25,38},
+    {25,26,39}, {26,27,40}, {27,28,41}, {28,29,42}, {29,30,43}, {30,31,44}, {31,32,45}, {32,33,46},
+    {33,34,47}, {34,35,48}, {35,36,49}, {36,37,50}, {37,38,51}, {38,39,52}, {39,40,53}, {40,41,54},
+    {41,42,0}, {42,43,1}, {43,44,2}, {44,45,3}, {45,46,4}, {46,47,5}, {47,48,6}, {48,49,7},
+    {49,50,8}, {50,51,9}, {51,52,10}, {52,53,11}, {53,54,12}, {54,0,13}, {0,2,26}, {1,3,27},
+    {2,4,28}, {3,5,29}, {4,6,30}, {5,7,31}, {6,8,32}, {7,9,33}, {8,10,34}, {9,11,35},
+    {10,12,36}, {11,13,37}, {12,14,38}, {13,15,39}, {14,16,40}, {15,17,41}, {16,18,42}, {17,19,43},
+    {18,20,44}, {19,21,45}, {20,22,46}, {21,23,47}, {22,24,48}, {23,25,49}, {24,26,50}, {25,27,51},
+    {26,28,52}, {27,29,53}, {28,30,54}, {29,31,0}, {30,32,1}, {31,33,2}, {32,34,3}, {33,35,4},
+    {34,36,5}, {35,37,6}, {36,38,7}, {37,39,8}, {38,40,9}, {39,41,10}, {40,42,11}, {41,43,12},
+    {42,44,13}, {43,45,14}, {44,46,15}, {45,47,16}, {46,48,17}, {47,49,18}, {48,50,19}, {49,51,20},
+    {50,52,21}, {51,53,22}, {52,54,23}, {53,0,24}, {54,1,25}, {0,3,20}, {1,4,21}, {2,5,22},
+    {3,6,23}, {4,7,24}, {5,8,25}, {6,9,26}, {7,10,27}, {8,11,28}, {9,12,29}, {10,13,30},
+    {11,14,31}, {12,15,32}, {13,16,33}, {14,17,34}, {15,18,35}, {16,19,36}, {17,20,37}, {18,21,38},
+    {19,22,39}, {20,23,40}, {21,24,41}, {22,25,42}, {23,26,43}, {24,27,44}, {25,28,45}, {26,29,46},
+    {27,30,47}, {28,31,48}, {29,32,49}, {30,33,50}, {31,34,51}, {32,35,52}, {33,36,53}, {34,37,54},
+    {35,38,0}, {36,39,1}, {37,40,2}, {38,41,3}, {39,42,4}, {40,43,5}, {41,44,6}, {42,45,7},
+    {43,46,8}, {44,47,9}, {45,48,10}, {46,49,11}, {47,50,12}, {48,51,13}, {49,52,14}, {50,53,15},
+    {51,54,16}, {52,0,17}, {53,1,18}, {54,2,19}, {0,4,16}, {1,5,17}, {2,6,18}, {3,7,19},
+    {4,8,20}, {5,9,21}, {6,10,22}, {7,11,23}, {8,12,24}, {9,13,25}, {10,14,26}, {11,15,27},
+    {12,16,28}, {13,17,29}, {14,18,30}, {15,19,31}, {16,20,32}, {17,21,33}, {18,22,34}, {19,23,35},
+    {20,24,36}, {21,25,37}, {22,26,38}, {23,27,39}, {24,28,40}, {25,29,41}, {26,30,42}, {27,31,43},
+    {28,32,44}, {29,33,45}, {30,34,46}, {31,35,47}, {32,36,48}, {33,37,49}, {34,38,50}, {35,39,51},
+    {36,40,52}, {37,41,53}, {38,42,54}, {39,43,0}, {40,44,1}, {41,45,2}, {42,46,3}, {43,47,4},
+    {44,48,5}, {45,49,6}, {46,50,7}, {47,51,8}, {48,52,9}, {49,53,10}, {50,54,11}, {51,0,12},
+    {52,1,13}, {53,2,14}, {54,3,15}, {0,5,28}, {1,6,29}, {2,7,30}, {3,8,31}, {4,9,32},
+    {5,10,33}, {6,11,34}, {7,12,35}, {8,13,36}, {9,14,37}, {10,15,38}, {11,16,39}, {12,17,40},
+    {13,18,41}, {14,19,42}, {15,20,43}, {16,21,44}, {17,22,45}, {18,23,46}, {19,24,47}, {20,25,48},
+    {21,26,49}, {22,27,50}, {23,28,51}, {24,29,52}, {25,30,53}, {26,31,54}, {27,32,0}, {28,33,1},
+    {29,34,2}, {30,35,3}, {31,36,4}, {32,37,5}, {33,38,6}, {34,39,7}, {35,40,8}, {36,41,9},
+    {37,42,10}, {38,43,11}, {39,44,12}, {40,45,13}, {41,46,14}, {42,47,15}, {43,48,16}, {44,49,17},
+    {45,50,18}, {46,51,19}, {47,52,20}, {48,53,21}, {49,54,22}, {50,0,23}, {51,1,24}, {52,2,25},
+    {53,3,26}, {54,4,27}, {0,6,21}, {1,7,22}, {2,8,23}, {3,9,24}, {4,10,25}, {5,11,26},
+    {6,12,27}, {7,13,28}, {8,14,29}, {9,15,30}, {10,16,31}, {11,17,32}, {12,18,33}, {13,19,34},
+    {14,20,35}, {15,21,36}, {16,22,37}, {17,23,38}, {18,24,39}, {19,25,40}, {20,26,41}, {21,27,42},
+    {22,28,43}, {23,29,44}, {24,30,45}, {25,31,46}, {26,32,47}, {27,33,48}, {28,34,49}, {29,35,50},
+    {30,36,51}, {31,37,52}, {32,38,53}, {33,39,54}, {34,40,0}, {35,41,1}, {36,42,2}, {37,43,3},
+    {38,44,4}, {39,45,5}, {40,46,6}, {41,47,7}, {42,48,8}, {43,49,9}, {44,50,10}, {45,51,11},
+    {46,52,12}, {47,53,13}, {48,54,14}, {49,0,15}, {50,1,16}, {51,2,17}, {52,3,18}, {53,4,19},
+    {54,5,20}, {0,7,18}, {1,8,19}, {2,9,20}, {3,10,21}, {4,11,22}, {5,12,23}, {6,13,24},
+    {7,14,25}, {8,15,26}, {9,16,27}, {10,17,28}, {11,18,29}, {12,19,30}, {13,20,31}, {14,21,32},
+    {15,22,33}, {16,23,34}, {17,24,35}, {18,25,36}, {19,26,37}, {20,27,38}, {21,28,39}, {22,29,40},
+    {23,30,41}, {24,31,42}, {25,32,43}, {26,33,44}, {27,34,45}, {28,35,46}, {29,36,47}, {30,37,48},
+    {31,38,49}, {32,39,50}, {33,40,51}, {34,41,52}, {35,42,53}, {36,43,54}, {37,44,0}, {38,45,1},
+    {39,46,2}, {40,47,3}, {41,48,4}, {42,49,5}, {43,50,6}, {44,51,7}, {45,52,8}, {46,53,9},
+    {47,54,10}, {48,0,11}, {49,1,12}, {50,2,13}, {51,3,14}, {52,4,15}, {53,5,16}, {54,6,17},
+    {0,8,30}, {1,9,31}, {2,10,32}, {3,11,33}, {4,12,34}, {5,13,35}, {6,14,36}, {7,15,37},
+    {8,16,38}, {9,17,39}, {10,18,40}, {11,19,41}, {12,20,42}, {13,21,43}, {14,22,44}, {15,23,45},
+    {16,24,46}, {17,25,47}, {18,26,48}, {19,27,49}, {20,28,50}, {21,29,51}, {22,30,52}, {23,31,53},
+    {24,32,54}, {25,33,0}, {26,34,1}, {27,35,2}, {28,36,3}, {29,37,4}, {30,38,5}, {31,39,6},
+    {32,40,7}, {33,41,8}, {34,42,9}, {35,43,10}, {36,44,11}, {37,45,12}, {38,46,13}, {39,47,14},
+    {40,48,15}, {41,49,16}, {42,50,17}, {43,51,18}, {44,52,19}, {45,53,20}, {46,54,21}, {47,0,22},
+    {48,1,23}, {49,2,24}, {50,3,25}, {51,4,26}, {52,5,27}, {53,6,28}, {54,7,29}
+};
+
+static const Terna_t STS_V057[532] = {
+    {0,1,26}, {1,2,27}, {2,3,28}, {3,4,29}, {4,5,30}, {5,6,31}, {6,7,32}, {7,8,33},
+    {8,9,34}, {9,10,35}, {10,11,36}, {11,12,37}, {12,13,38}, {13,14,39}, {14,15,40}, {15,16,41},
+    {16,17,42}, {17,18,43}, {18,19,44}, {19,20,45}, {20,21,46}, {21,22,47}, {22,23,48}, {23,24,49},
+    {24,25,50}, {25,26,51}, {26,27,52}, {27,28,53}, {28,29,54}, {29,30,55}, {30,31,56}, {31,32,0},
+    {32,33,1}, {33,34,2}, {34,35,3}, {35,36,4}, {36,37,5}, {37,38,6}, {38,39,7}, {39,40,8},
+    {40,41,9}, {41,42,10}, {42,43,11}, {43,44,12}, {44,45,13}, {45,46,14}, {46,47,15}, {47,48,16},
+    {48,49,17}, {49,50,18}, {50,51,19}, {51,52,20}, {52,53,21}, {53,54,22}, {54,55,23}, {55,56,24},
+    {56,0,25}, {0,2,14}, {1,3,15}, {2,4,16}, {3,5,17}, {4,6,18}, {5,7,19}, {6,8,20},
+    {7,9,21}, {8,10,22}, {9,11,23}, {10,12,24}, {11,13,25}, {12,14,26}, {13,15,27}, {14,16,28},
+    {15,17,29}, {16,18,30}, {17,19,31}, {18,20,32}, {19,21,33}, {20,22,34}, {21,23,35}, {22,24,36},
+    {23,25,37}, {24,26,38}, {25,27,39}, {26,28,40}, {27,29,41}, {28,30,42}, {29,31,43}, {30,32,44},
+    {31,33,45}, {32,34,46}, {33,35,47}, {34,36,48}, {35,37,49}, {36,38,50}, {37,39,51}, {38,40,52},
+    {39,41,53}, {40,42,54}, {41,43,55}, {42,44,56}, {43,45,0}, {44,46,1}, {45,47,2}, {46,48,3},
+    {47,49,4}, {48,50,5}, {49,51,6}, {50,52,7}, {51,53,8}, {52,54,9}, {53,55,10}, {54,56,11},
+    {55,0,12}, {56,1,13}, {0,3,20}, {1,4,21}, {2,5,22}, {3,6,23}, {4,7,24}, {5,8,25},
+    {6,9,26}, {7,10,27}, {8,11,28}, {9,12,29}, {10,13,30}, {11,14,31}, {12,15,32}, {13,16,33},
+    {14,17,34}, {15,18,35}, {16,19,36}, {17,20,37}, {18,21,38}, {19,22,39}, {20,23,40}, {21,24,41},
+    {22,25,42}, {23,26,43}, {24,27,44}, {25,28,45}, {26,29,46}, {27,30,47}, {28,31,48}, {29,32,49},
+    {30,33,50}, {31,34,51}, {32,35,52}, {33,36,53}, {34,37,54}, {35,38,55}, {36,39,56}, {37,40,0},
+    {38,41,1}, {39,42,2}, {40,43,3}, {41,44,4}, {42,45,5}, {43,46,6}, {44,47,7}, {45,48,8},
+    {46,49,9}, {47,50,10}, {48,51,11}, {49,52,12}, {50,53,13}, {51,54,14}, {52,55,15}, {53,56,16},
+    {54,0,17}, {55,1,18}, {56,2,19}, {0,4,28}, {1,5,29}, {2,6,30}, {3,7,31}, {4,8,32},
+    {5,9,33}, {6,10,34}, {7,11,35}, {8,12,36}, {9,13,37}, {10,14,38}, {11,15,39}, {12,16,40},
+    {13,17,41}, {14,18,42}, {15,19,43}, {16,20,44}, {17,21,45}, {18,22,46}, {19,23,47}, {20,24,48},
+    {21,25,49}, {22,26,50}, {23,27,51}, {24,28,52}, {25,29,53}, {26,30,54}, {27,31,55}, {28,32,56},
+    {29,33,0}, {30,34,1}, {31,35,2}, {32,36,3}, {33,37,4}, {34,38,5}, {35,39,6}, {36,40,7},
+    {37,41,8}, {38,42,9}, {39,43,10}, {40,44,11}, {41,45,12}, {42,46,13}, {43,47,14}, {44,48,15},
+    {45,49,16}, {46,50,17}, {47,51,18}, {48,52,19}, {49,53,20}, {50,54,21}, {51,55,22}, {52,56,23},
+    {53,0,24}, {54,1,25}, {55,2,26}, {56,3,27}, {0,5,16}, {1,6,17}, {2,7,18}, {3,8,19},
+    {4,9,20}, {5,10,21}, {6,11,22}, {7,12,23}, {8,13,24}, {9,14,25}, {10,15,26}, {11,16,27},
+    {12,17,28}, {13,18,29}, {14,19,30}, {15,20,31}, {16,21,32}, {17,22,33}, {18,23,34}, {19,24,35},
+    {20,25,36}, {21,26,37}, {22,27,38}, {23,28,39}, {24,29,40}, {25,30,41}, {26,31,42}, {27,32,43},
+    {28,33,44}, {29,34,45}, {30,35,46}, {31,36,47}, {32,37,48}, {33,38,49}, {34,39,50}, {35,40,51},
+    {36,41,52}, {37,42,53}, {38,43,54}, {39,44,55}, {40,45,56}, {41,46,0}, {42,47,1}, {43,48,2},
+    {44,49,3}, {45,50,4}, {46,51,5}, {47,52,6}, {48,53,7}, {49,54,8}, {50,55,9}, {51,56,10},
+    {52,0,11}, {53,1,12}, {54,2,13}, {55,3,14}, {56,4,15}, {0,6,21}, {1,7,22}, {2,8,23},
+    {3,9,24}, {4,10,25}, {5,11,26}, {6,12,27}, {7,13,28}, {8,14,29}, {9,15,30}, {10,16,31},
+    {11,17,32}, {12,18,33}, {13,19,34}, {14,20,35}, {15,21,36}, {16,22,37}, {17,23,38}, {18,24,39},
+    {19,25,40}, {20,26,41}, {21,27,42}, {22,28,43}, {23,29,44}, {24,30,45}, {25,31,46}, {26,32,47},
+    {27,33,48}, {28,34,49}, {29,35,50}, {30,36,51}, {31,37,52}, {32,38,53}, {33,39,54}, {34,40,55},
+    {35,41,56}, {36,42,0}, {37,43,1}, {38,44,2}, {39,45,3}, {40,46,4}, {41,47,5}, {42,48,6},
+    {43,49,7}, {44,50,8}, {45,51,9}, {46,52,10}, {47,53,11}, {48,54,12}, {49,55,13}, {50,56,14},
+    {51,0,15}, {52,1,16}, {53,2,17}, {54,3,18}, {55,4,19}, {56,5,20}, {0,7,30}, {1,8,31},
+    {2,9,32}, {3,10,33}, {4,11,34}, {5,12,35}, {6,13,36}, {7,14,37}, {8,15,38}, {9,16,39},
+    {10,17,40}, {11,18,41}, {12,19,42}, {13,20,43}, {14,21,44}, {15,22,45}, {16,23,46}, {17,24,47},
+    {18,25,48}, {19,26,49}, {20,27,50}, {21,28,51}, {22,29,52}, {23,30,53}, {24,31,54}, {25,32,55},
+    {26,33,56}, {27,34,0}, {28,35,1}, {29,36,2}, {30,37,3}, {31,38,4}, {32,39,5}, {33,40,6},
+    {34,41,7}, {35,42,8}, {36,43,9}, {37,44,10}, {38,45,11}, {39,46,12}, {40,47,13}, {41,48,14},
+    {42,49,15}, {43,50,16}, {44,51,17}, {45,52,18}, {46,53,19}, {47,54,20}, {48,55,21}, {49,56,22},
+    {50,0,23}, {51,1,24}, {52,2,25}, {53,3,26}, {54,4,27}, {55,5,28}, {56,6,29}, {0,8,18},
+    {1,9,19}, {2,10,20}, {3,11,21}, {4,12,22}, {5,13,23}, {6,14,24}, {7,15,25}, {8,16,26},
+    {9,17,27}, {10,18,28}, {11,19,29}, {12,20,30}, {13,21,31}, {14,22,32}, {15,23,33}, {16,24,34},
+    {17,25,35}, {18,26,36}, {19,27,37}, {20,28,38}, {21,29,39}, {22,30,40}, {23,31,41}, {24,32,42},
+    {25,33,43}, {26,34,44}, {27,35,45}, {28,36,46}, {29,37,47}, {30,38,48}, {31,39,49}, {32,40,50},
+    {33,41,51}, {34,42,52}, {35,43,53}, {36,44,54}, {37,45,55}, {38,46,56}, {39,47,0}, {40,48,1},
+    {41,49,2}, {42,50,3}, {43,51,4}, {44,52,5}, {45,53,6}, {46,54,7}, {47,55,8}, {48,56,9},
+    {49,0,10}, {50,1,11}, {51,2,12}, {52,3,13}, {53,4,14}, {54,5,15}, {55,6,16}, {56,7,17},
+    {0,9,22}, {1,10,23}, {2,11,24}, {3,12,25}, {4,13,26}, {5,14,27}, {6,15,28}, {7,16,29},
+    {8,17,30}, {9,18,31}, {10,19,32}, {11,20,33}, {12,21,34}, {13,22,35}, {14,23,36}, {15,24,37},
+    {16,25,38}, {17,26,39}, {18,27,40}, {19,28,41}, {20,29,42}, {21,30,43}, {22,31,44}, {23,32,45},
+    {24,33,46}, {25,34,47}, {26,35,48}, {27,36,49}, {28,37,50}, {29,38,51}, {30,39,52}, {31,40,53},
+    {32,41,54}, {33,42,55}, {34,43,56}, {35,44,0}, {36,45,1}, {37,46,2}, {38,47,3}, {39,48,4},
+    {40,49,5}, {41,50,6}, {42,51,7}, {43,52,8}, {44,53,9}, {45,54,10}, {46,55,11}, {47,56,12},
+    {48,0,13}, {49,1,14}, {50,2,15}, {51,3,16}, {52,4,17}, {53,5,18}, {54,6,19}, {55,7,20},
+    {56,8,21}, {0,19,38}, {1,20,39}, {2,21,40}, {3,22,41}, {4,23,42}, {5,24,43}, {6,25,44},
+    {7,26,45}, {8,27,46}, {9,28,47}, {10,29,48}, {11,30,49}, {12,31,50}, {13,32,51}, {14,33,52},
+    {15,34,53}, {16,35,54}, {17,36,55}, {18,37,56}
+};
+
+static const Terna_t STS_V061[610] = {
+    {0,10,24}, {1,11,25}, {2,12,26}, {3,13,27}, {4,14,28}, {5,15,29}, {6,16,30}, {7,17,31},
+    {8,18,32}, {9,19,33}, {10,20,34}, {11,21,35}, {12,22,36}, {13,23,37}, {14,24,38}, {15,25,39},
+    {16,26,40}, {17,27,41}, {18,28,42}, {19,29,43}, {20,30,44}, {21,31,45}, {22,32,46}, {23,33,47},
+    {24,34,48}, {25,35,49}, {26,36,50}, {27,37,51}, {28,38,52}, {29,39,53}, {30,40,54}, {31,41,55},
+    {32,42,56}, {33,43,57}, {34,44,58}, {35,45,59}, {36,46,60}, {37,47,0}, {38,48,1}, {39,49,2},
+    {40,50,3}, {41,51,4}, {42,52,5}, {43,53,6}, {44,54,7}, {45,55,8}, {46,56,9}, {47,57,10},
+    {48,58,11}, {49,59,12}, {50,60,13}, {51,0,14}, {52,1,15}, {53,2,16}, {54,3,17}, {55,4,18},
+    {56,5,19}, {57,6,20}, {58,7,21}, {59,8,22}, {60,9,23}, {0,1,28}, {1,2,29}, {2,3,30},
+    {3,4,31}, {4,5,32}, {5,6,33}, {6,7,34}, {7,8,35}, {8,9,36}, {9,10,37}, {10,11,38},
+    {11,12,39}, {12,13,40}, {13,14,41}, {14,15,42}, {15,16,43}, {16,17,44}, {17,18,45}, {18,19,46},
+    {19,20,47}, {20,21,48}, {21,22,49}, {22,23,50}, {23,24,51}, {24,25,52}, {25,26,53}, {26,27,54},
+    {27,28,55}, {28,29,56}, {29,30,57}, {30,31,58}, {31,32,59}, {32,33,60}, {33,34,0}, {34,35,1},
+    {35,36,2}, {36,37,3}, {37,38,4}, {38,39,5}, {39,40,6}, {40,41,7}, {41,42,8}, {42,43,9},
+    {43,44,10}, {44,45,11}, {45,46,12}, {46,47,13}, {47,48,14}, {48,49,15}, {49,50,16}, {50,51,17},
+    {51,52,18}, {52,53,19}, {53,54,20}, {54,55,21}, {55,56,22}, {56,57,23}, {57,58,24}, {58,59,25},
+    {59,60,26}, {60,0,27}, {0,2,21}, {1,3,22}, {2,4,23}, {3,5,24}, {4,6,25}, {5,7,26},
+    {6,8,27}, {7,9,28}, {8,10,29}, {9,11,30}, {10,12,31}, {11,13,32}, {12,14,33}, {13,15,34},
+    {14,16,35}, {15,17,36}, {16,18,37}, {17,19,38}, {18,20,39}, {19,21,40}, {20,22,41}, {21,23,42},
+    {22,24,43}, {23,25,44}, {24,26,45}, {25,27,46}, {26,28,47}, {27,29,48}, {28,30,49}, {29,31,50},
+    {30,32,51}, {31,33,52}, {32,34,53}, {33,35,54}, {34,36,55}, {35,37,56}, {36,38,57}, {37,39,58},
+    {38,40,59}, {39,41,60}, {40,42,0}, {41,43,1}, {42,44,2}, {43,45,3}, {44,46,4}, {45,47,5},
+    {46,48,6}, {47,49,7}, {48,50,8}, {49,51,9}, {50,52,10}, {51,53,11}, {52,54,12}, {53,55,13},
+    {54,56,14}, {55,57,15}, {56,58,16}, {57,59,17}, {58,60,18}, {59,0,19}, {60,1,20}, {0,3,16},
+    {1,4,17}, {2,5,18}, {3,6,19}, {4,7,20}, {5,8,21}, {6,9,22}, {7,10,23}, {8,11,24},
+    {9,12,25}, {10,13,26}, {11,14,27}, {12,15,28}, {13,16,29}, {14,17,30}, {15,18,31}, {16,19,32},
+    {17,20,33}, {18,21,34}, {19,22,35}, {20,23,36}, {21,24,37}, {22,25,38}, {23,26,39}, {24,27,40},
+    {25,28,41}, {26,29,42}, {27,30,43}, {28,31,44}, {29,32,45}, {30,33,46}, {31,34,47}, {32,35,48},
+    {33,36,49}, {34,37,50}, {35,38,51}, {36,39,52}, {37,40,53}, {38,41,54}, {39,42,55}, {40,43,56},
+    {41,44,57}, {42,45,58}, {43,46,59}, {44,47,60}, {45,48,0}, {46,49,1}, {47,50,2}, {48,51,3},
+    {49,52,4}, {50,53,5}, {51,54,6}, {52,55,7}, {53,56,8}, {54,57,9}, {55,58,10}, {56,59,11},
+    {57,60,12}, {58,0,13}, {59,1,14}, {60,2,15}, {0,4,30}, {1,5,31}, {2,6,32}, {3,7,33},
+    {4,8,34}, {5,9,35}, {6,10,36}, {7,11,37}, {8,12,38}, {9,13,39}, {10,14,40}, {11,15,41},
+    {12,16,42}, {13,17,43}, {14,18,44}, {15,19,45}, {16,20,46}, {17,21,47}, {18,22,48}, {19,23,49},
+    {20,24,50}, {21,25,51}, {22,26,52}, {23,27,53}, {24,28,54}, {25,29,55}, {26,30,56}, {27,31,57},
+    {28,32,58}, {29,33,59}, {30,34,60}, {31,35,0}, {32,36,1}, {33,37,2}, {34,38,3}, {35,39,4},
+    {36,40,5}, {37,41,6}, {38,42,7}, {39,43,8}, {40,44,9}, {41,45,10}, {42,46,11}, {43,47,12},
+    {44,48,13}, {45,49,14}, {46,50,15}, {47,51,16}, {48,52,17}, {49,53,18}, {50,54,19}, {51,55,20},
+    {52,56,21}, {53,57,22}, {54,58,23}, {55,59,24}, {56,60,25}, {57,0,26}, {58,1,27}, {59,2,28},
+    {60,3,29}, {0,5,22}, {1,6,23}, {2,7,24}, {3,8,25}, {4,9,26}, {5,10,27}, {6,11,28},
+    {7,12,29}, {8,13,30}, {9,14,31}, {10,15,32}, {11,16,33}, {12,17,34}, {13,18,35}, {14,19,36},
+    {15,20,37}, {16,21,38}, {17,22,39}, {18,23,40}, {19,24,41}, {20,25,42}, {21,26,43}, {22,27,44},
+    {23,28,45}, {24,29,46}, {25,30,47}, {26,31,48}, {27,32,49}, {28,33,50}, {29,34,51}, {30,35,52},
+    {31,36,53}, {32,37,54}, {33,38,55}, {34,39,56}, {35,40,57}, {36,41,58}, {37,42,59}, {38,43,60},
+    {39,44,0}, {40,45,1}, {41,46,2}, {42,47,3}, {43,48,4}, {44,49,5}, {45,50,6}, {46,51,7},
+    {47,52,8}, {48,53,9}, {49,54,10}, {50,55,11}, {51,56,12}, {52,57,13}, {53,58,14}, {54,59,15},
+    {55,60,16}, {56,0,17}, {57,1,18}, {58,2,19}, {59,3,20}, {60,4,21}, {0,6,18}, {1,7,19},
+    {2,8,20}, {3,9,21}, {4,10,22}, {5,11,23}, {6,12,24}, {7,13,25}, {8,14,26}, {9,15,27},
+    {10,16,28}, {11,17,29}, {12,18,30}, {13,19,31}, {14,20,32}, {15,21,33}, {16,22,34}, {17,23,35},
+    {18,24,36}, {19,25,37}, {20,26,38}, {21,27,39}, {22,28,40}, {23,29,41}, {24,30,42}, {25,31,43},
+    {26,32,44}, {27,33,45}, {28,34,46}, {29,35,47}, {30,36,48}, {31,37,49}, {32,38,50}, {33,39,51},
+    {34,40,52}, {35,41,53}, {36,42,54}, {37,43,55}, {38,44,56}, {39,45,57}, {40,46,58}, {41,47,59},
+    {42,48,60}, {43,49,0}, {44,50,1}, {45,51,2}, {46,52,3}, {47,53,4}, {48,54,5}, {49,55,6},
+    {50,56,7}, {51,57,8}, {52,58,9}, {53,59,10}, {54,60,11}, {55,0,12}, {56,1,13}, {57,2,14},
+    {58,3,15}, {59,4,16}, {60,5,17}, {0,7,32}, {1,8,33}, {2,9,34}, {3,10,35}, {4,11,36},
+    {5,12,37}, {6,13,38}, {7,14,39}, {8,15,40}, {9,16,41}, {10,17,42}, {11,18,43}, {12,19,44},
+    {13,20,45}, {14,21,46}, {15,22,47}, {16,23,48}, {17,24,49}, {18,25,50}, {19,26,51}, {20,27,52},
+    {21,28,53}, {22,29,54}, {23,30,55}, {24,31,56}, {25,32,57}, {26,33,58}, {27,34,59}, {28,35,60},
+    {29,36,0}, {30,37,1}, {31,38,2}, {32,39,3}, {33,40,4}, {34,41,5}, {35,42,6}, {36,43,7},
+    {37,44,8}, {38,45,9}, {39,46,10}, {40,47,11}, {41,48,12}, {42,49,13}, {43,50,14}, {44,51,15},
+    {45,52,16}, {46,53,17}, {47,54,18}, {48,55,19}, {49,56,20}, {50,57,21}, {51,58,22}, {52,59,23},
+    {53,60,24}, {54,0,25}, {55,1,26}, {56,2,27}, {57,3,28}, {58,4,29}, {59,5,30}, {60,6,31},
+    {0,8,23}, {1,9,24}, {2,10,25}, {3,11,26}, {4,12,27}, {5,13,28}, {6,14,29}, {7,15,30},
+    {8,16,31}, {9,17,32}, {10,18,33}, {11,19,34}, {12,20,35}, {13,21,36}, {14,22,37}, {15,23,38},
+    {16,24,39}, {17,25,40}, {18,26,41}, {19,27,42}, {20,28,43}, {21,29,44}, {22,30,45}, {23,31,46},
+    {24,32,47}, {25,33,48}, {26,34,49}, {27,35,50}, {28,36,51}, {29,37,52}, {30,38,53}, {31,39,54},
+    {32,40,55}, {33,41,56}, {34,42,57}, {35,43,58}, {36,44,59}, {37,45,60}, {38,46,0}, {39,47,1},
+    {40,48,2}, {41,49,3}, {42,50,4}, {43,51,5}, {44,52,6}, {45,53,7}, {46,54,8}, {47,55,9},
+    {48,56,10}, {49,57,11}, {50,58,12}, {51,59,13}, {52,60,14}, {53,0,15}, {54,1,16}, {55,2,17},
+    {56,3,18}, {57,4,19}, {58,5,20}, {59,6,21}, {60,7,22}, {0,9,20}, {1,10,21}, {2,11,22},
+    {3,12,23}, {4,13,24}, {5,14,25}, {6,15,26}, {7,16,27}, {8,17,28}, {9,18,29}, {10,19,30},
+    {11,20,31}, {12,21,32}, {13,22,33}, {14,23,34}, {15,24,35}, {16,25,36}, {17,26,37}, {18,27,38},
+    {19,28,39}, {20,29,40}, {21,30,41}, {22,31,42}, {23,32,43}, {24,33,44}, {25,34,45}, {26,35,46},
+    {27,36,47}, {28,37,48}, {29,38,49}, {30,39,50}, {31,40,51}, {32,41,52}, {33,42,53}, {34,43,54},
+    {35,44,55}, {36,45,56}, {37,46,57}, {38,47,58}, {39,48,59}, {40,49,60}, {41,50,0}, {42,51,1},
+    {43,52,2}, {44,53,3}, {45,54,4}, {46,55,5}, {47,56,6}, {48,57,7}, {49,58,8}, {50,59,9},
+    {51,60,10}, {52,0,11}, {53,1,12}, {54,2,13}, {55,3,14}, {56,4,15}, {57,5,16}, {58,6,17},
+    {59,7,18}, {60,8,19}
+};
+
+static const Terna_t STS_V063[651] = {
+    {0,1,16}, {1,2,17}, {2,3,18}, {3,4,19}, {4,5,20}, {5,6,21}, {6,7,22}, {7,8,23},
+    {8,9,24}, {9,10,25}, {10,11,26}, {11,12,27}, {12,13,28}, {13,14,29}, {14,15,30}, {15,16,31},
+    {16,17,32}, {17,18,33}, {18,19,34}, {19,20,35}, {20,21,36}, {21,22,37}, {22,23,38}, {23,24,39},
+    {24,25,40}, {25,26,41}, {26,27,42}, {27,28,43}, {28,29,44}, {29,30,45}, {30,31,46}, {31,32,47},
+    {32,33,48}, {33,34,49}, {34,35,50}, {35,36,51}, {36,37,52}, {37,38,53}, {38,39,54}, {39,40,55},
+    {40,41,56}, {41,42,57}, {42,43,58}, {43,44,59}, {44,45,60}, {45,46,61}, {46,47,62}, {47,48,0},
+    {48,49,1}, {49,50,2}, {50,51,3}, {51,52,4}, {52,53,5}, {53,54,6}, {54,55,7}, {55,56,8},
+    {56,57,9}, {57,58,10}, {58,59,11}, {59,60,12}, {60,61,13}, {61,62,14}, {62,0,15}, {0,2,29},
+    {1,3,30}, {2,4,31}, {3,5,32}, {4,6,33}, {5,7,34}, {6,8,35}, {7,9,36}, {8,10,37},
+    {9,11,38}, {10,12,39}, {11,13,40}, {12,14,41}, {13,15,42}, {14,16,43}, {15,17,44}, {16,18,45},
+    {17,19,46}, {18,20,47}, {19,21,48}, {20,22,49}, {21,23,50}, {22,24,51}, {23,25,52}, {24,26,53},
+    {25,27,54}, {26,28,55}, {27,29,56}, {28,30,57}, {29,31,58}, {30,32,59}, {31,33,60}, {32,34,61},
+    {33,35,62}, {34,36,0}, {35,37,1}, {36,38,2}, {37,39,3}, {38,40,4}, {39,41,5}, {40,42,6},
+    {41,43,7}, {42,44,8}, {43,45,9}, {44,46,10}, {45,47,11}, {46,48,12}, {47,49,13}, {48,50,14},
+    {49,51,15}, {50,52,16}, {51,53,17}, {52,54,18}, {53,55,19}, {54,56,20}, {55,57,21}, {56,58,22},
+    {57,59,23}, {58,60,24}, {59,61,25}, {60,62,26}, {61,0,27}, {62,1,28}, {0,3,28}, {1,4,29},
+    {2,5,30}, {3,6,31}, {4,7,32}, {5,8,33}, {6,9,34}, {7,10,35}, {8,11,36}, {9,12,37},
+    {10,13,38}, {11,14,39}, {12,15,40}, {13,16,41}, {14,17,42}, {15,18,43}, {16,19,44}, {17,20,45},
+    {18,21,46}, {19,22,47}, {20,23,48}, {21,24,49}, {22,25,50}, {23,26,51}, {24,27,52}, {25,28,53},
+    {26,29,54}, {27,30,55}, {28,31,56}, {29,32,57}, {30,33,58}, {31,34,59}, {32,35,60}, {33,36,61},
+    {34,37,62}, {35,38,0}, {36,39,1}, {37,40,2}, {38,41,3}, {39,42,4}, {40,43,5}, {41,44,6},
+    {42,45,7}, {43,46,8}, {44,47,9}, {45,48,10}, {46,49,11}, {47,50,12}, {48,51,13}, {49,52,14},
+    {50,53,15}, {51,54,16}, {52,55,17}, {53,56,18}, {54,57,19}, {55,58,20}, {56,59,21}, {57,60,22},
+    {58,61,23}, {59,62,24}, {60,0,25}, {61,1,26}, {62,2,27}, {0,4,18}, {1,5,19}, {2,6,20},
+    {3,7,21}, {4,8,22}, {5,9,23}, {6,10,24}, {7,11,25}, {8,12,26}, {9,13,27}, {10,14,28},
+    {11,15,29}, {12,16,30}, {13,17,31}, {14,18,32}, {15,19,33}, {16,20,34}, {17,21,35}, {18,22,36},
+    {19,23,37}, {20,24,38}, {21,25,39}, {22,26,40}, {23,27,41}, {24,28,42}, {25,29,43}, {26,30,44},
+    {27,31,45}, {28,32,46}, {29,33,47}, {30,34,48}, {31,35,49}, {32,36,50}, {33,37,51}, {34,38,52},
+    {35,39,53}, {36,40,54}, {37,41,55}, {38,42,56}, {39,43,57}, {40,44,58}, {41,45,59}, {42,46,60},
+    {43,47,61}, {44,48,62}, {45,49,0}, {46,50,1}, {47,51,2}, {48,52,3}, {49,53,4}, {50,54,5},
+    {51,55,6}, {52,56,7}, {53,57,8}, {54,58,9}, {55,59,10}, {56,60,11}, {57,61,12}, {58,62,13},
+    {59,0,14}, {60,1,15}, {61,2,16}, {62,3,17}, {0,5,31}, {1,6,32}, {2,7,33}, {3,8,34},
+    {4,9,35}, {5,10,36}, {6,11,37}, {7,12,38}, {8,13,39}, {9,14,40}, {10,15,41}, {11,16,42},
+    {12,17,43}, {13,18,44}, {14,19,45}, {15,20,46}, {16,21,47}, {17,22,48}, {18,23,49}, {19,24,50},
+    {20,25,51}, {21,26,52}, {22,27,53}, {23,28,54}, {24,29,55}, {25,30,56}, {26,31,57}, {27,32,58},
+    {28,33,59}, {29,34,60}, {30,35,61}, {31,36,62}, {32,37,0}, {33,38,1}, {34,39,2}, {35,40,3},
+    {36,41,4}, {37,42,5}, {38,43,6}, {39,44,7}, {40,45,8}, {41,46,9}, {42,47,10}, {43,48,11},
+    {44,49,12}, {45,50,13}, {46,51,14}, {47,52,15}, {48,53,16}, {49,54,17}, {50,55,18}, {51,56,19},
+    {52,57,20}, {53,58,21}, {54,59,22}, {55,60,23}, {56,61,24}, {57,62,25}, {58,0,26}, {59,1,27},
+    {60,2,28}, {61,3,29}, {62,4,30}, {0,6,23}, {1,7,24}, {2,8,25}, {3,9,26}, {4,10,27},
+    {5,11,28}, {6,12,29}, {7,13,30}, {8,14,31}, {9,15,32}, {10,16,33}, {11,17,34}, {12,18,35},
+    {13,19,36}, {14,20,37}, {15,21,38}, {16,22,39}, {17,23,40}, {18,24,41}, {19,25,42}, {20,26,43},
+    {21,27,44}, {22,28,45}, {23,29,46}, {24,30,47}, {25,31,48}, {26,32,49}, {27,33,50}, {28,34,51},
+    {29,35,52}, {30,36,53}, {31,37,54}, {32,38,55}, {33,39,56}, {34,40,57}, {35,41,58}, {36,42,59},
+    {37,43,60}, {38,44,61}, {39,45,62}, {40,46,0}, {41,47,1}, {42,48,2}, {43,49,3}, {44,50,4},
+    {45,51,5}, {46,52,6}, {47,53,7}, {48,54,8}, {49,55,9}, {50,56,10}, {51,57,11}, {52,58,12},
+    {53,59,13}, {54,60,14}, {55,61,15}, {56,62,16}, {57,0,17}, {58,1,18}, {59,2,19}, {60,3,20},
+    {61,4,21}, {62,5,22}, {0,7,20}, {1,8,21}, {2,9,22}, {3,10,23}, {4,11,24}, {5,12,25},
+    {6,13,26}, {7,14,27}, {8,15,28}, {9,16,29}, {10,17,30}, {11,18,31}, {12,19,32}, {13,20,33},
+    {14,21,34}, {15,22,35}, {16,23,36}, {17,24,37}, {18,25,38}, {19,26,39}, {20,27,40}, {21,28,41},
+    {22,29,42}, {23,30,43}, {24,31,44}, {25,32,45}, {26,33,46}, {27,34,47}, {28,35,48}, {29,36,49},
+    {30,37,50}, {31,38,51}, {32,39,52}, {33,40,53}, {34,41,54}, {35,42,55}, {36,43,56}, {37,44,57},
+    {38,45,58}, {39,46,59}, {40,47,60}, {41,48,61}, {42,49,62}, {43,50,0}, {44,51,1}, {45,52,2},
+    {46,53,3}, {47,54,4}, {48,55,5}, {49,56,6}, {50,57,7}, {51,58,8}, {52,59,9}, {53,60,10},
+    {54,61,11}, {55,62,12}, {56,0,13}, {57,1,14}, {58,2,15}, {59,3,16}, {60,4,17}, {61,5,18},
+    {62,6,19}, {0,8,19}, {1,9,20}, {2,10,21}, {3,11,22}, {4,12,23}, {5,13,24}, {6,14,25},
+    {7,15,26}, {8,16,27}, {9,17,28}, {10,18,29}, {11,19,30}, {12,20,31}, {13,21,32}, {14,22,33},
+    {15,23,34}, {16,24,35}, {17,25,36}, {18,26,37}, {19,27,38}, {20,28,39}, {21,29,40}, {22,30,41},
+    {23,31,42}, {24,32,43}, {25,33,44}, {26,34,45}, {27,35,46}, {28,36,47}, {29,37,48}, {30,38,49},
+    {31,39,50}, {32,40,51}, {33,41,52}, {34,42,53}, {35,43,54}, {36,44,55}, {37,45,56}, {38,46,57},
+    {39,47,58}, {40,48,59}, {41,49,60}, {42,50,61}, {43,51,62}, {44,52,0}, {45,53,1}, {46,54,2},
+    {47,55,3}, {48,56,4}, {49,57,5}, {50,58,6}, {51,59,7}, {52,60,8}, {53,61,9}, {54,62,10},
+    {55,0,11}, {56,1,12}, {57,2,13}, {58,3,14}, {59,4,15}, {60,5,16}, {61,6,17}, {62,7,18},
+    {0,9,33}, {1,10,34}, {2,11,35}, {3,12,36}, {4,13,37}, {5,14,38}, {6,15,39}, {7,16,40},
+    {8,17,41}, {9,18,42}, {10,19,43}, {11,20,44}, {12,21,45}, {13,22,46}, {14,23,47}, {15,24,48},
+    {16,25,49}, {17,26,50}, {18,27,51}, {19,28,52}, {20,29,53}, {21,30,54}, {22,31,55}, {23,32,56},
+    {24,33,57}, {25,34,58}, {26,35,59}, {27,36,60}, {28,37,61}, {29,38,62}, {30,39,0}, {31,40,1},
+    {32,41,2}, {33,42,3}, {34,43,4}, {35,44,5}, {36,45,6}, {37,46,7}, {38,47,8}, {39,48,9},
+    {40,49,10}, {41,50,11}, {42,51,12}, {43,52,13}, {44,53,14}, {45,54,15}, {46,55,16}, {47,56,17},
+    {48,57,18}, {49,58,19}, {50,59,20}, {51,60,21}, {52,61,22}, {53,62,23}, {54,0,24}, {55,1,25},
+    {56,2,26}, {57,3,27}, {58,4,28}, {59,5,29}, {60,6,30}, {61,7,31}, {62,8,32}, {0,10,22},
+    {1,11,23}, {2,12,24}, {3,13,25}, {4,14,26}, {5,15,27}, {6,16,28}, {7,17,29}, {8,18,30},
+    {9,19,31}, {10,20,32}, {11,21,33}, {12,22,34}, {13,23,35}, {14,24,36}, {15,25,37}, {16,26,38},
+    {17,27,39}, {18,28,40}, {19,29,41}, {20,30,42}, {21,31,43}, {22,32,44}, {23,33,45}, {24,34,46},
+    {25,35,47}, {26,36,48}, {27,37,49}, {28,38,50}, {29,39,51}, {30,40,52}, {31,41,53}, {32,42,54},
+    {33,43,55}, {34,44,56}, {35,45,57}, {36,46,58}, {37,47,59}, {38,48,60}, {39,49,61}, {40,50,62},
+    {41,51,0}, {42,52,1}, {43,53,2}, {44,54,3}, {45,55,4}, {46,56,5}, {47,57,6}, {48,58,7},
+    {49,59,8}, {50,60,9}, {51,61,10}, {52,62,11}, {53,0,12}, {54,1,13}, {55,2,14}, {56,3,15},
+    {57,4,16}, {58,5,17}, {59,6,18}, {60,7,19}, {61,8,20}, {62,9,21}, {0,21,42}, {1,22,43},
+    {2,23,44}, {3,24,45}, {4,25,46}, {5,26,47}, {6,27,48}, {7,28,49}, {8,29,50}, {9,30,51},
+    {10,31,52}, {11,32,53}, {12,33,54}, {13,34,55}, {14,35,56}, {15,36,57}, {16,37,58}, {17,38,59},
+    {18,39,60}, {19,40,61}, {20,41,62}
+};
+
+typedef struct {
+    const Terna_t* terne;
+    uint32_t       b;
+} STSC_piccolo_t;
+
+// Tabella di dispatch ad accesso diretto, indicizzata da v
+static const STSC_piccolo_t STSC_PICCOLI[STSC_PICCOLI_MAX + 1] = {
+    [7] = {STS_V007, 7U},
+    [13] = {STS_V013, 26U},
+    [15] = {STS_V015, 35U},
+    [19] = {STS_V019, 57U},
+    [21] = {STS_V021, 70U},
+    [25] = {STS_V025, 100U},
+    [27] = {STS_V027, 117U},
+    [31] = {STS_V031, 155U},
+    [33] = {STS_V033, 176U},
+    [37] = {STS_V037, 222U},
+    [39] = {STS_V039, 247U},
+    [43] = {STS_V043, 301U},
+    [45] = {STS_V045, 330U},
+    [49] = {STS_V049, 392U},
+    [51] = {STS_V051, 425U},
+    [55] = {STS_V055, 495U},
+    [57] = {STS_V057, 532U},
+    [61] = {STS_V061, 610U},
+    [63] = {STS_V063, 651U},
+};
+#endif
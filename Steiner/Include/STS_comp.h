@@ -0,0 +1,114 @@
+#ifndef _LIB_STS_COMP_H_
+ #define _LIB_STS_COMP_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "STSC.h"
+
+// Massimo numero di livelli di composizione (ogni livello almeno raddoppia v)
+#define MAX_LIVELLI 64
+
+// Ordine massimo della base sotto il quale non si scompone ulteriormente
+#define SOGLIA_BASE 64U
+
+// Costruzioni ricorsive disponibili per ciascun livello
+typedef enum {
+    STS_BASE,               // STS(1), STS(3) banali oppure STS ciclico
+    STS_BOSE,               // Base diretta di Bose, u = 6n+3
+    STS_SKOLEM,             // Base diretta di Skolem, u = 6n+1
+    STS_RADDOPPIO,          // STS(u) -> STS(2u+1)
+    STS_TRIPLICAZIONE       // STS(u) -> STS(3u)
+} STS_op_t;
+
+// Descrittore di livello
+typedef struct {
+    uint32_t v;             // Ordine dello STS a questo livello
+    STS_op_t op;            // Costruzione che lo produce dal livello inferiore
+    size_t   b;             // Terne totali a questo livello
+} STS_livello_t;
+
+// Sistema composto: liv[0] e' la base, liv[livelli - 1] il sistema completo
+typedef struct {
+    size_t        v;
+    size_t        b;
+    size_t        livelli;
+    STS_livello_t liv[MAX_LIVELLI];
+    size_t        td;       // Terne differenza della base ciclica
+    Terna_t*      TDiff;    // (NULL per le basi banali)
+} STS_comp_t;
+
+/********************************************************************************/
+/*
+** STS_comp_base()
+**
+** Scopo:
+**   - Restituisce l'ordine della base che STS_comp_init() userebbe per v,
+**     senza allocare nulla. Le basi oltre SOGLIA_BASE sono costruzioni
+**     dirette di Bose o Skolem, prive di limiti d'ordine.
+**
+** Valore restituito:
+**   - size_t: ordine della base, 0 se v non e' ammissibile.
+*/
+/********************************************************************************/
+size_t STS_comp_base(size_t v);
+
+/********************************************************************************/
+/*
+** STS_comp_init()
+**
+** Scopo:
+**   - Pianifica la scomposizione di STS(v) in una catena di raddoppi
+**     (2u+1) e triplicazioni (3u) a partire da una base, preferendo la
+**     triplicazione. La base e' STS(1), STS(3) oppure uno STS ciclico di
+**     Genera_STSC() di ordine non superiore a SOGLIA_BASE, di cui si
+**     conservano le sole terne differenza. Se la catena si interrompe su
+**     un ordine maggiore, la base e' la costruzione diretta di Bose
+**     (6n+3) o di Skolem (6n+1), calcolata terna per terna.
+**   - Memoria occupata: O(log v) descrittori piu' le terne differenza
+**     di una base con al piu' SOGLIA_BASE punti, nessuna terna del sistema viene mai generata in anticipo.
+**
+** Parametri:
+**   - STS_comp_t* c...: Descrittore da inizializzare.
+**   - size_t v........: La dimensione dello STS, della forma 6n+1 oppure 6n+3.
+**
+** Valore restituito:
+**   - bool: false se v non e' ammissibile o in caso di errore di allocazione.
+*/
+/********************************************************************************/
+bool STS_comp_init(STS_comp_t* c, size_t v);
+
+/********************************************************************************/
+/*
+** STS_comp_terna()
+**
+** Scopo:
+**   - Restituisce la terna di indice i del sistema composto, calcolata
+**     su richiesta in tempo O(livelli).
+**
+** Parametri:
+**   - const STS_comp_t* c.: Descrittore inizializzato.
+**   - size_t i............: Indice della terna, 0 <= i < c->b.
+**
+** Valore restituito:
+**   - Terna_t: La terna richiesta.
+*/
+/********************************************************************************/
+Terna_t STS_comp_terna(const STS_comp_t* c, size_t i);
+
+/********************************************************************************/
+/*
+** STS_comp_intervallo()
+**
+** Scopo:
+**   - Genera le terne di indice da..da+n-1 nell'array STS, allocato a
+**     carico del chiamante. Intervalli disgiunti possono essere generati
+**     in parallelo da thread diversi.
+**
+** Valore restituito:
+**   - size_t: Numero di terne scritte (troncato a c->b).
+*/
+/********************************************************************************/
+size_t STS_comp_intervallo(const STS_comp_t* c, size_t da, size_t n, Terna_t* STS);
+
+void STS_comp_libera(STS_comp_t* c);
+#endif
@@ -0,0 +1,61 @@
+#ifndef _LIB_STS_COPERTURA_H_
+ #define _LIB_STS_COPERTURA_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "STSC.h"
+
+// Terne generate per ogni chiamata interna a STS_comp_intervallo()
+#define COPERTURA_BLOCCO 4096U
+
+// Caso di test: n = 3 parametri, oppure n = 2 per le terne troncate
+typedef struct {
+    uint32_t p[3];
+    uint32_t n;
+} Caso_t;
+
+/*
+** Sink per la generazione in streaming dei casi di test.
+** Restituendo false il sink interrompe la generazione.
+*/
+typedef bool (*Caso_sink_t)(const Caso_t* c, void* ctx);
+
+/********************************************************************************/
+/*
+** Ordine_copertura()
+**
+** Scopo:
+**   - Restituisce il minimo ordine ammissibile v >= p (v = 1, 3 mod 6) dello
+**     STS da cui si ricava la copertura di p parametri. STS_comp accetta
+**     ogni ordine ammissibile, quindi v <= p + 3.
+*/
+/********************************************************************************/
+size_t Ordine_copertura(size_t p);
+
+/********************************************************************************/
+/*
+** Genera_copertura()
+**
+** Scopo:
+**   - Genera in streaming una suite di test a coppie per p parametri,
+**     numerati 0..p-1, in cui ogni coppia di parametri compare in
+**     esattamente un caso di test.
+**   - Si parte dallo STS(v) con v = Ordine_copertura(p), prodotto su
+**     richiesta da STS_comp (base ciclica, di Bose o di Skolem), e si
+**     eliminano i punti p..v-1: le terne che ne contengono uno diventano
+**     casi di due parametri, quelle che ne contengono due o tre vengono
+**     scartate.
+**   - Memoria costante: le terne vengono prodotte a blocchi di
+**     COPERTURA_BLOCCO, mai memorizzate per intero.
+**
+** Parametri:
+**   - size_t p.........: Numero di parametri, p >= 2.
+**   - Caso_sink_t sink.: Funzione che riceve i casi di test.
+**   - void* ctx........: Contesto opaco passato al sink.
+**
+** Valore restituito:
+**   - uint64_t: numero di casi emessi; 0 in caso d'errore.
+*/
+/********************************************************************************/
+uint64_t Genera_copertura(size_t p, Caso_sink_t sink, void* ctx);
+#endif
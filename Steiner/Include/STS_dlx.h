@@ -0,0 +1,47 @@
+#ifndef _LIB_STS_DLX_H_
+ #define _LIB_STS_DLX_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "STSC.h"
+
+/*
+** Sink per le soluzioni del problema delle differenze di Heffter: riceve
+** le td terne differenza di una soluzione, pronte per Genera_STSC_da_terne().
+** Restituendo false il sink interrompe la ricerca. Le chiamate sono
+** serializzate anche con OpenMP.
+*/
+typedef bool (*TD_sink_t)(const Terna_t* TDiff, size_t td, void* ctx);
+
+/********************************************************************************/
+/*
+** Cerca_terne_differenza()
+**
+** Scopo:
+**   - Risolve per ricerca esaustiva il problema delle differenze di Heffter
+**     per v = 6n+1 oppure 6n+3: partizionare le differenze 1..(v-1)/2
+**     (escluso v/3 se v = 6n+3) in n terne {a, b, c} con a + b = c oppure
+**     a + b + c = v. Ogni soluzione definisce uno STS ciclico.
+**   - Il problema e' formulato come exact cover e risolto con l'algoritmo X
+**     di Knuth e i dancing links. Con OpenMP i sottoalberi delle scelte per
+**     la differenza 1 vengono distribuiti tra i thread, ciascuno con una
+**     propria copia della matrice: l'ordine delle soluzioni non e' quindi
+**     deterministico.
+**   - Con canoniche = true si emette una sola soluzione per classe di
+**     equivalenza rispetto ai moltiplicatori m in Z_v^*, ossia quella
+**     lessicograficamente minima tra le immagini m * D.
+**
+** Parametri:
+**   - size_t v.........: Ordine dello STS, v >= 7, v != 9.
+**   - size_t limite....: Numero massimo di soluzioni emesse (0 = nessun limite).
+**   - bool canoniche...: Filtro per equivalenza rispetto ai moltiplicatori.
+**   - TD_sink_t sink...: Facoltativo (NULL per il solo conteggio).
+**   - void* ctx........: Contesto opaco passato al sink.
+**
+** Valore restituito:
+**   - size_t: numero di soluzioni emesse (o contate).
+*/
+/********************************************************************************/
+size_t Cerca_terne_differenza(size_t v, size_t limite, bool canoniche,
+                              TD_sink_t sink, void* ctx);
+#endif
@@ -0,0 +1,80 @@
+#ifndef _LIB_STS_FANO_H_
+ #define _LIB_STS_FANO_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "STSC.h"
+
+/*
+** Sottosistema STS(7) (piano di Fano) nella forma p = {a, b, c, e, d, f, g}
+** generata da tre punti non allineati a, b, e. Le sette rette sono sempre:
+**   {p0,p1,p2} {p0,p3,p4} {p1,p3,p5} {p2,p3,p6} {p0,p5,p6} {p1,p4,p6} {p2,p4,p5}
+*/
+typedef struct {
+    uint32_t p[7];
+} Fano_t;
+
+/*
+** Sink per l'enumerazione dei sottosistemi. Restituendo false il sink
+** interrompe la ricerca. Le chiamate sono serializzate anche con OpenMP.
+*/
+typedef bool (*Fano_sink_t)(const Fano_t* f, void* ctx);
+
+/********************************************************************************/
+/*
+** STS_quasigruppo()
+**
+** Scopo:
+**   - Costruisce la tabella v x v del quasigruppo di Steiner associato
+**     allo STS: Q[x*v + y] e' il terzo punto della terna che contiene
+**     x e y, con Q[x*v + x] = x.
+**   - Memoria: 4 v^2 byte, allocati con malloc() e da liberare con free().
+**
+** Valore restituito:
+**   - uint32_t*: NULL in caso d'errore (punti fuori range, coppie ripetute
+**     o mancanti: l'array non e' uno STS(v)).
+*/
+/********************************************************************************/
+uint32_t* STS_quasigruppo(size_t v, const Terna_t* STS, size_t b);
+
+/********************************************************************************/
+/*
+** STS_ciclico()
+**
+** Scopo:
+**   - Verifica se lo STS e' invariante per la traslazione x -> x + 1 (mod v),
+**     ossia se vale Q[(x+1)*v + (y+1)] = Q[x*v + y] + 1 per ogni terna.
+*/
+/********************************************************************************/
+bool STS_ciclico(size_t v, const uint32_t* Q, const Terna_t* STS, size_t b);
+
+/********************************************************************************/
+/*
+** Conta_Fano()
+**
+** Scopo:
+**   - Conta (ed eventualmente enumera) i sottosistemi STS(7) di uno STS(v).
+**   - Ogni sottosistema viene trovato una sola volta, dalla terna canonica
+**     di generatori: a = minimo, b = minimo dei restanti, e = minimo dei
+**     punti fuori dalla retta {a, b, a.b}. La chiusura si verifica con tre
+**     sole letture del quasigruppo.
+**   - Se lo STS e' ciclico la ricerca si limita ai sottosistemi per il
+**     punto 0, in O(v^2): il totale e' N0 * v / 7 e gli altri sottosistemi
+**     si ottengono per traslazione. Altrimenti si esegue la ricerca
+**     generale in O(v^3).
+**   - Con OpenMP, la ricerca e' ripartita tra i thread sulle coppie
+**     iniziali (a, b).
+**
+** Parametri:
+**   - size_t v.........: Ordine dello STS.
+**   - const Terna_t* STS, size_t b: Le terne (ad es. da Genera_STSC()).
+**   - Fano_sink_t sink.: Facoltativo (NULL per il solo conteggio).
+**   - void* ctx........: Contesto opaco passato al sink.
+**
+** Valore restituito:
+**   - uint64_t: numero di sottosistemi STS(7); 0 anche in caso d'errore.
+*/
+/********************************************************************************/
+uint64_t Conta_Fano(size_t v, const Terna_t* STS, size_t b,
+                    Fano_sink_t sink, void* ctx);
+#endif
@@ -0,0 +1,93 @@
+#ifndef _LIB_STS_GRAFO_H_
+ #define _LIB_STS_GRAFO_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "STSC.h"
+
+#define GRAFO_MAGIC    "STBG"
+#define GRAFO_VERSIONE 1U
+
+/*
+** Header del file binario CSR (32 byte). Seguono, senza padding:
+**   uint64_t righe[nodi + 1];  offset di ogni riga in col[]
+**   uint32_t col[archi];       vicini di ogni blocco, in ordine crescente
+** Tutti i campi sono nell'endianness nativa e allineati al proprio tipo,
+** quindi il file puo' essere mappato in memoria ed usato senza copie.
+*/
+typedef struct {
+    char     magic[4];      // "STBG"
+    uint32_t versione;      // GRAFO_VERSIONE
+    uint32_t v;             // Ordine dello STS
+    uint32_t grado;         // Grado costante 3(r - 1), r = (v - 1) / 2
+    uint64_t nodi;          // Numero di blocchi b
+    uint64_t archi;         // Elementi di col[]: nodi * grado (archi orientati)
+} GrafoHeader;
+
+// Grafo di intersezione dei blocchi in formato CSR
+typedef struct {
+    uint32_t  v;
+    uint32_t  grado;
+    uint64_t  nodi;
+    uint64_t  archi;
+    uint64_t* righe;
+    uint32_t* col;
+    void*     mem;          // Memoria allocata (NULL se il grafo e' mappato)
+} STS_grafo_t;
+
+/********************************************************************************/
+/*
+** STS_grafo_costruisci()
+**
+** Scopo:
+**   - Costruisce il grafo di intersezione dei blocchi: due terne sono
+**     adiacenti se condividono un punto. Si parte dall'incidenza
+**     punto -> blocchi: ogni punto contribuisce una cricca delle sue
+**     r = (v-1)/2 terne, e poiche' due terne condividono al piu' un punto
+**     le tre liste di ogni blocco sono disgiunte. Costo O(b v).
+**   - Le righe vengono riempite in parallelo con OpenMP, come fusione
+**     ordinata delle tre liste di incidenza.
+**   - Memoria: circa b * 3(r-1) * 4 byte, ossia ~v^3 byte.
+**
+** Parametri:
+**   - size_t v.........: Ordine dello STS.
+**   - const Terna_t* STS, size_t b: Le terne (ad es. da Genera_STSC()).
+**   - STS_grafo_t* g...: Grafo da inizializzare.
+**
+** Valore restituito:
+**   - bool: false in caso d'errore (memoria, terne non valide: punti
+**     fuori da 0..v-1 o ripetuti, coppie coperte piu' di una volta).
+*/
+/********************************************************************************/
+bool STS_grafo_costruisci(size_t v, const Terna_t* STS, size_t b, STS_grafo_t* g);
+
+/********************************************************************************/
+/*
+** STS_grafo_scrivi()
+**
+** Scopo:
+**   - Salva il grafo nel formato binario CSR descritto da GrafoHeader.
+**
+** Valore restituito:
+**   - bool: false in caso d'errore di I/O.
+*/
+/********************************************************************************/
+bool STS_grafo_scrivi(const STS_grafo_t* g, const char* nome);
+
+/********************************************************************************/
+/*
+** STS_grafo_da_memoria()
+**
+** Scopo:
+**   - Collega il grafo al contenuto di un file CSR gia' in memoria (tipicamente
+**     mappato con mmap() o MapViewOfFile()), senza copie, dopo aver
+**     verificato header e dimensioni.
+**
+** Valore restituito:
+**   - bool: false se il buffer non contiene un grafo valido.
+*/
+/********************************************************************************/
+bool STS_grafo_da_memoria(const void* base, size_t size, STS_grafo_t* g);
+
+void STS_grafo_libera(STS_grafo_t* g);
+#endif
@@ -0,0 +1,116 @@
+#ifndef _LIB_TORNEO_H_
+ #define _LIB_TORNEO_H_
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TORNEO_MAGIC    "RRTN"
+#define TORNEO_VERSIONE 1U
+
+// Avversario restituito alla squadra che riposa (n dispari)
+#define TORNEO_RIPOSO   UINT32_MAX
+
+// Massimo numero di squadre: gli indici devono stare in uint32_t
+#define TORNEO_MAX_SQUADRE (UINT32_MAX - 1U)
+
+// Incontro tra le squadre a e b, a < b
+typedef struct {
+    uint32_t a;
+    uint32_t b;
+} Incontro_t;
+
+/*
+** Header del file binario del calendario (32 byte). Seguono, senza padding,
+** giornate * incontri elementi Incontro_t, giornata per giornata.
+** Tutti i campi sono nell'endianness nativa, come per GrafoHeader.
+*/
+typedef struct {
+    char     magic[4];      // "RRTN"
+    uint32_t versione;      // TORNEO_VERSIONE
+    uint32_t n;             // Numero di squadre
+    uint32_t giornate;      // n - 1 se n pari, n se n dispari
+    uint32_t incontri;      // Incontri per giornata: floor(n / 2)
+    uint32_t riservato;
+    uint64_t totale;        // giornate * incontri
+} TorneoHeader;
+
+/********************************************************************************/
+/*
+** Torneo_giornate()
+**
+** Scopo:
+**   - Numero di giornate del girone all'italiana con n squadre.
+*/
+/********************************************************************************/
+size_t Torneo_giornate(size_t n);
+
+/********************************************************************************/
+/*
+** Torneo_avversario()
+**
+** Scopo:
+**   - Avversario della squadra s nella giornata g, in tempo O(1).
+**   - Il calendario e' quello del QLCI di genera_qlci() (QLCI.c): con
+**     m = n dispari, la cella (i, j) del quadrato vale la giornata in cui
+**     si incontrano i e j, mentre la diagonale (idempotenza) indica la
+**     squadra a riposo. Nella giornata g si ha quindi i + j = 2g (mod m)
+**     e l'avversario di s e' 2g - s (mod m); la squadra g riposa.
+**   - Con n pari si usa il QLCI di ordine m = n - 1 e la squadra a riposo
+**     incontra la squadra n - 1.
+**
+** Parametri:
+**   - size_t n.: Numero di squadre, 2 <= n <= TORNEO_MAX_SQUADRE.
+**   - size_t g.: Giornata, 0 <= g < Torneo_giornate(n).
+**   - size_t s.: Squadra, 0 <= s < n.
+**
+** Valore restituito:
+**   - uint32_t: l'avversario, oppure TORNEO_RIPOSO.
+*/
+/********************************************************************************/
+uint32_t Torneo_avversario(size_t n, size_t g, size_t s);
+
+/********************************************************************************/
+/*
+** Torneo_giornata_di()
+**
+** Scopo:
+**   - Funzione inversa: giornata dell'incontro tra le squadre i != j,
+**     in tempo O(1). Corrisponde alla cella (i, j) del QLCI, meno uno.
+*/
+/********************************************************************************/
+size_t Torneo_giornata_di(size_t n, size_t i, size_t j);
+
+/********************************************************************************/
+/*
+** Torneo_giornata()
+**
+** Scopo:
+**   - Scrive gli incontri della giornata g: con m dispari il t-esimo e'
+**     {g - t, g + t} (mod m), t = 1..(m-1)/2, preceduto da {g, n - 1} se
+**     n e' pari. Nessuna matrice n x n: O(n) tempo, senza divisioni.
+**
+** Parametri:
+**   - size_t n, g.........: Come per Torneo_avversario().
+**   - Incontro_t* inc.....: Array di n / 2 elementi, a carico del chiamante.
+**
+** Valore restituito:
+**   - size_t: numero di incontri scritti; 0 in caso d'errore.
+*/
+/********************************************************************************/
+size_t Torneo_giornata(size_t n, size_t g, Incontro_t* inc);
+
+/********************************************************************************/
+/*
+** Torneo_scrivi()
+**
+** Scopo:
+**   - Salva l'intero calendario nel formato binario descritto da
+**     TorneoHeader, una giornata alla volta: la memoria e' O(n).
+**   - Dimensione: 32 + 4n(n-1) byte circa, ossia ~40 GB per 10^5 squadre.
+**
+** Valore restituito:
+**   - bool: false in caso d'errore di I/O o parametri non validi.
+*/
+/********************************************************************************/
+bool Torneo_scrivi(size_t n, const char* nome);
+#endif